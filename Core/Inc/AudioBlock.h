@@ -0,0 +1,112 @@
+#pragma once
+//====================================================================================
+// AudioBlock.h
+//
+// Views on a block of stereo audio frames.
+//
+// AudioBlock describes where the Left and Right samples of a block live:
+//   - Planar      : two separate arrays (Stride = 1), filled directly by the
+//                   conversion stage in Audio.cpp.
+//   - Interleaved : an AudioBuffer array seen in place (Stride = 2), so effects
+//                   written for the interleaved layout keep working without copy.
+//
+// Copyright (c) 2025 Dad Design.
+//====================================================================================
+#include "main.h"
+#include <cstddef>
+
+// Alignment of planar channel arrays (Cortex-M7 cache line)
+#define AUDIO_BLOCK_ALIGN 32
+
+//***********************************************************************************
+// struct AudioBlock
+// Non-owning view on nFrames stereo frames.
+//***********************************************************************************
+struct AudioBlock {
+	float*	Left;		// First Left sample
+	float*	Right;		// First Right sample
+	size_t	Stride;		// Distance in floats between two frames of a channel
+	size_t	Size;		// Number of frames
+
+	// --------------------------------------------------------------------------
+	// Planar view on two channel arrays
+	static inline AudioBlock Planar(float* pLeft, float* pRight, size_t nFrames) {
+		return AudioBlock{pLeft, pRight, 1, nFrames};
+	}
+
+	// --------------------------------------------------------------------------
+	// Zero-copy view on an interleaved AudioBuffer array
+	// (an input view is only read, the const is dropped to share the type)
+	static inline AudioBlock Interleaved(const AudioBuffer* pBuffer, size_t nFrames) {
+		AudioBuffer* pFrames = const_cast<AudioBuffer*>(pBuffer);
+		return AudioBlock{&pFrames->Left, &pFrames->Right,
+			              sizeof(AudioBuffer) / sizeof(float), nFrames};
+	}
+
+	// --------------------------------------------------------------------------
+	// Returns true if channels are stored in separate contiguous arrays
+	inline bool isPlanar() const { return Stride == 1; }
+
+	// --------------------------------------------------------------------------
+	// Frame accessors
+	inline float& L(size_t Index) const { return Left[Index * Stride]; }
+	inline float& R(size_t Index) const { return Right[Index * Stride]; }
+
+	// --------------------------------------------------------------------------
+	// Reads / writes one frame as an AudioBuffer
+	inline AudioBuffer getFrame(size_t Index) const {
+		return AudioBuffer{R(Index), L(Index)};
+	}
+	inline void setFrame(size_t Index, const AudioBuffer& Frame) const {
+		L(Index) = Frame.Left;
+		R(Index) = Frame.Right;
+	}
+};
+
+//***********************************************************************************
+// struct AudioPlanarBuffer
+// Storage for a planar block of up to N frames, channels aligned on cache lines.
+//***********************************************************************************
+template<size_t N>
+struct AudioPlanarBuffer {
+	alignas(AUDIO_BLOCK_ALIGN) float Left[N];
+	alignas(AUDIO_BLOCK_ALIGN) float Right[N];
+
+	// --------------------------------------------------------------------------
+	// Planar view on the first nFrames frames
+	inline AudioBlock getBlock(size_t nFrames = N) {
+		return AudioBlock::Planar(Left, Right, nFrames);
+	}
+
+	// --------------------------------------------------------------------------
+	// Fill with silence
+	inline void Clear() {
+		for (size_t Index = 0; Index < N; Index++) {
+			Left[Index] = 0.0f;
+			Right[Index] = 0.0f;
+		}
+	}
+};
+
+// ----------------------------------------------------------------------------------
+// Adapter for effects that only implement the per-frame interleaved interface
+// ProcessSample(const AudioBuffer*, AudioBuffer*).
+// Interleaved blocks are passed in place; planar frames go through one
+// AudioBuffer on the stack (no block copy).
+template<typename tEffect>
+inline void ProcessInterleaved(tEffect& Effect, const AudioBlock& In, const AudioBlock& Out) {
+	if (!In.isPlanar() && !Out.isPlanar()) {
+		const AudioBuffer* pIn = reinterpret_cast<const AudioBuffer*>(In.Right);
+		AudioBuffer* pOut = reinterpret_cast<AudioBuffer*>(Out.Right);
+		for (size_t Index = 0; Index < In.Size; Index++) {
+			Effect.ProcessSample(&pIn[Index], &pOut[Index]);
+		}
+	} else {
+		for (size_t Index = 0; Index < In.Size; Index++) {
+			AudioBuffer FrameIn = In.getFrame(Index);
+			AudioBuffer FrameOut;
+			Effect.ProcessSample(&FrameIn, &FrameOut);
+			Out.setFrame(Index, FrameOut);
+		}
+	}
+}
@@ -0,0 +1,67 @@
+#pragma once
+//====================================================================================
+// AudioConvert.h
+//
+// int24 <-> float sample conversion kernels of the SAI path (Audio.cpp).
+//
+// 24-bit samples are carried in the low bits of 32-bit SAI words, interleaved
+// Left / Right. Both conversions are branchless and exact for every 24-bit code;
+// the block kernels handle two frames per iteration.
+//
+// Copyright (c) 2025 Dad Design.
+//====================================================================================
+#include "main.h"
+#include <cstddef>
+
+constexpr float kInt24Scale = 8388608.0f;					// 2^23
+constexpr float kInvInt24Scale = 1.0f / 8388608.0f;			// 2^-23 (exact)
+
+// ------------------------------------------------------------------------
+// Convert a 24-bit sample to float in the range [-1.0, 1.0[
+inline float int32ToFloat(int32_t sample) {
+    // Sign extension: move bit 23 to bit 31 then arithmetic shift back
+    int32_t Extended = static_cast<int32_t>(static_cast<uint32_t>(sample) << 8) >> 8;
+    // Normalize by 2^23 (power of two: multiplication is exact)
+    return static_cast<float>(Extended) * kInvInt24Scale;
+}
+
+// ------------------------------------------------------------------------
+// Convert a float sample to a 24-bit sample with saturation
+inline int32_t floatToInt32(float sample) {
+    // Scale by 2^23 (exact), then saturate to the 24-bit range with
+    // compare-selects: vsel on the M7 FPU, maxps/minps once vectorized on x86
+    // (clamping before the scale lets GCC branch to constant results).
+    // NaN gives -1.0.
+    float Scaled = sample * kInt24Scale;
+    Scaled = (Scaled > -kInt24Scale) ? Scaled : -kInt24Scale;
+    Scaled = (Scaled < kInt24Scale - 1.0f) ? Scaled : kInt24Scale - 1.0f;
+
+    // Convert to a signed 24-bit integer and keep the 24 data bits
+    return static_cast<int32_t>(Scaled) & 0xFFFFFF;
+}
+
+// ------------------------------------------------------------------------
+// Convert nFrames interleaved int32_t frames to planar channels
+// (nFrames even, two frames per iteration)
+inline void ConvertToPlanar(const int32_t* __restrict intBuf, float* __restrict pLeft, float* __restrict pRight, size_t nFrames) {
+    for (size_t i = 0; i < nFrames; i += 2) {
+        const int32_t* pSrc = &intBuf[i * 2];
+        pLeft[i]      = int32ToFloat(pSrc[0]);
+        pRight[i]     = int32ToFloat(pSrc[1]);
+        pLeft[i + 1]  = int32ToFloat(pSrc[2]);
+        pRight[i + 1] = int32ToFloat(pSrc[3]);
+    }
+}
+
+// ------------------------------------------------------------------------
+// Convert nFrames planar frames to interleaved int32_t frames
+// (nFrames even, two frames per iteration)
+inline void ConvertFromPlanar(const float* __restrict pLeft, const float* __restrict pRight, int32_t* __restrict intBuf, size_t nFrames) {
+    for (size_t i = 0; i < nFrames; i += 2) {
+        int32_t* pDst = &intBuf[i * 2];
+        pDst[0] = floatToInt32(pLeft[i]);
+        pDst[1] = floatToInt32(pRight[i]);
+        pDst[2] = floatToInt32(pLeft[i + 1]);
+        pDst[3] = floatToInt32(pRight[i + 1]);
+    }
+}
@@ -45,4 +45,7 @@
 
 //-------------------------------------------------------------------------
 // If you want to use the DMA2D graphics accelerator, uncomment the following line.
+// (not available in the host build)
+#ifndef PENDA_HOST
 #define USE_DMA2D
+#endif
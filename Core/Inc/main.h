@@ -133,22 +133,38 @@ void MX_TIM6_Init(void);
 #define MONITOR
 #endif
 
+// Define AUDIO_DEFERRED to run the effect in PendSV (lowest priority) instead of
+// the SAI DMA callbacks. Adds one block of latency; xruns are counted.
+//#define AUDIO_DEFERRED
+
 // Define FONTH to load resources in code (.h file).
 // Comment out #define FONTH to use resources loaded in QSPI flash. See https://github.com/DADDesign-Projects/Daisy_QSPI_Flasher  for more information.
 // USE RAM allows you to automatically change the resource loading mode depending on the Debug or Release build mode
-#ifdef USE_RAM
+// PENDA_HOST (host build, see Host/) always uses the resources compiled in code.
+#if defined(USE_RAM) || defined(PENDA_HOST)
 #define FONTH
 #endif
 
 /* Sections ---------------------------------------------------------*/
+#ifndef PENDA_HOST
 #define SDRAM_SECTION __attribute__((section(".SDRAM_Section")))
 #define QFLASH_SECTION __attribute__((section(".QFLASH_Section")))
 #define NO_CACHE_RAM __attribute__((section(".RAM_NO_CACHE_Section")))
 #define ITCM __attribute__((section(".moveITCM")))
+#define DTCM_SECTION __attribute__((section(".DTCM_Section")))
+#else
+#include "HostSections.h"
+#endif
 
 
 /* Audio ---------------------------------------------------------*/
-#define AUDIO_BUFFER_SIZE 4
+// Audio block size (frames per DMA half buffer), selected at boot from a
+// persistent system setting: 4, 8, 16, 32 or 64 frames.
+#define AUDIO_BUFFER_SIZE_MIN 4
+#define AUDIO_BUFFER_SIZE_MAX 64
+#define AUDIO_BUFFER_SIZE_DEFAULT 4
+extern uint32_t __AudioBufferSize;
+#define AUDIO_BUFFER_SIZE __AudioBufferSize
 #define SAMPLING_RATE 48000.0f
 #define UI_RT_SAMPLING_RATE (SAMPLING_RATE / (float) AUDIO_BUFFER_SIZE)
 
@@ -161,6 +177,9 @@ enum eOnOff{
 	On
 };
 extern HAL_StatusTypeDef StartAudio();
+#ifdef AUDIO_DEFERRED
+extern void AudioDeferredProcess(void);
+#endif
 
 // =====** END DAD **=================================================================
 /* USER CODE END Private defines */
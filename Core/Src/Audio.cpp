@@ -6,12 +6,19 @@
 // Copyright(c) 2025 Dad Design.
 //****************************************************************************
 #include "main.h"
+#include "AudioBlock.h"
+#include "AudioConvert.h"
+#ifdef AUDIO_DEFERRED
+#include "cDeferredAudio.h"
+#include "cMonitor.h"
+#endif
 
 extern SAI_HandleTypeDef hsai_BlockA1;
 extern SAI_HandleTypeDef hsai_BlockB1;
 
 #define SAI_HALF_BUFFER_SIZE  (AUDIO_BUFFER_SIZE * 2) // Stereo
 #define SAI_BUFFER_SIZE 	  (AUDIO_BUFFER_SIZE * 4)
+#define SAI_BUFFER_SIZE_MAX   (AUDIO_BUFFER_SIZE_MAX * 4)
 
 extern enum HardRev{
 	Rev5,
@@ -21,69 +28,130 @@ extern enum HardRev{
 // ------------------------------------------------------------------------
 // AudioCallback
 // ------------------------------------------------------------------------
-extern void AudioCallback(AudioBuffer *pIn, AudioBuffer *pOut);
+extern void AudioCallback(const AudioBlock &In, const AudioBlock &Out);
 
-// Audio Buffer
-NO_CACHE_RAM AudioBuffer In[AUDIO_BUFFER_SIZE];
-NO_CACHE_RAM AudioBuffer Out1[AUDIO_BUFFER_SIZE];
-NO_CACHE_RAM AudioBuffer Out2[AUDIO_BUFFER_SIZE];
+// ------------------------------------------------------------------------
+// Active audio block size (frames), set before StartAudio()
+// ------------------------------------------------------------------------
+uint32_t __AudioBufferSize = AUDIO_BUFFER_SIZE_DEFAULT;
+
+// Audio Buffer (planar: separate Left / Right arrays)
+// Sized for the largest block, only AUDIO_BUFFER_SIZE frames are used.
+using tAudioBuffer = AudioPlanarBuffer<AUDIO_BUFFER_SIZE_MAX>;
+NO_CACHE_RAM tAudioBuffer In;
+NO_CACHE_RAM tAudioBuffer Out1;
+NO_CACHE_RAM tAudioBuffer Out2;
+
+NO_CACHE_RAM tAudioBuffer* pOut;
+NO_CACHE_RAM int32_t rxBuffer[SAI_BUFFER_SIZE_MAX];
+NO_CACHE_RAM int32_t txBuffer[SAI_BUFFER_SIZE_MAX];
+
+#ifdef AUDIO_DEFERRED
+// ------------------------------------------------------------------------
+// Deferred processing: the DMA callbacks only convert samples, the effect
+// runs in PendSV (lowest priority). Slot 0 = first half of the DMA buffers,
+// slot 1 = second half; each slot keeps its own input until it is processed.
+// ------------------------------------------------------------------------
+NO_CACHE_RAM tAudioBuffer In2;
+tAudioBuffer* const __pSlotIn[DadMisc::NB_AUDIO_SLOTS]  = {&In, &In2};
+tAudioBuffer* const __pSlotOut[DadMisc::NB_AUDIO_SLOTS] = {&Out1, &Out2};
+DadMisc::cDeferredAudio __DeferredAudio;
+
+// Tick source for deadline accounting
+static uint32_t ReadCycleCounter(){
+	return DWT->CYCCNT;
+}
+#endif
+
+// ------------------------------------------------------------------------
+// Sample conversion (kernels in AudioConvert.h)
+// ------------------------------------------------------------------------
+static_assert((AUDIO_BUFFER_SIZE_MIN % 2) == 0, "Conversion kernels process two frames per iteration");
+
+// ------------------------------------------------------------------------
+// Convert interleaved int32_t buffer to a planar block
+ITCM void ConvertToAudioBuffer(const int32_t* intBuf, tAudioBuffer& floatBuf) {
+    ConvertToPlanar(intBuf, floatBuf.Left, floatBuf.Right, AUDIO_BUFFER_SIZE);
+}
 
-NO_CACHE_RAM AudioBuffer* pOut;
-NO_CACHE_RAM int32_t rxBuffer[SAI_BUFFER_SIZE];
-NO_CACHE_RAM int32_t txBuffer[SAI_BUFFER_SIZE];
+// ------------------------------------------------------------------------
+// Convert a planar block to interleaved int32_t buffer
+ITCM void ConvertFromAudioBuffer(const tAudioBuffer& floatBuf, int32_t* intBuf) {
+    ConvertFromPlanar(floatBuf.Left, floatBuf.Right, intBuf, AUDIO_BUFFER_SIZE);
+}
 
+#ifdef AUDIO_DEFERRED
 // ------------------------------------------------------------------------
-// Convert int32_t buffer to float AudioBuffer
+// Fill one half of txBuffer with the last processed block (silence on xrun)
 // ------------------------------------------------------------------------
-inline float int32ToFloat(int32_t sample) {
-    // Check if the sign bit (bit 23) is set
-    if (sample & 0x00800000) {
-        // Extend the sign bit to 32-bit (two’s complement format)
-        sample |= 0xFF000000;
+ITCM void TransmitSlot(int32_t* intBuf) {
+    int8_t Slot = __DeferredAudio.OutputSlot();
+    if (Slot != DadMisc::NO_AUDIO_SLOT) {
+        ConvertFromAudioBuffer(*__pSlotOut[Slot], intBuf);
     } else {
-        // Ensure only the lower 24 bits are used
-        sample &= 0x00FFFFFF;
+        for (size_t i = 0; i < SAI_HALF_BUFFER_SIZE; i++) {
+            intBuf[i] = 0;
+        }
     }
-    // Normalize to the range [-1.0, 1.0] by dividing by 2^23
-    return static_cast<float>(sample) / 8388608.0f;
 }
 
-ITCM void ConvertToAudioBuffer( int32_t* intBuf, AudioBuffer* floatBuf) {
-    for (size_t i = 0; i < AUDIO_BUFFER_SIZE; i++) {
-        floatBuf[i].Left = int32ToFloat(intBuf[i * 2]);
-        floatBuf[i].Right = int32ToFloat(intBuf[i * 2 + 1]);
+// ------------------------------------------------------------------------
+// Convert one half of rxBuffer into its slot and trigger the DSP stage
+// ------------------------------------------------------------------------
+ITCM void CaptureSlot(uint8_t Slot, const int32_t* intBuf) {
+    if (__DeferredAudio.CaptureInput(Slot)) {
+        ConvertToAudioBuffer(intBuf, *__pSlotIn[Slot]);
+        SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;
     }
 }
 
 // ------------------------------------------------------------------------
-// Convert float AudioBuffer to int32_t buffer
+// Deferred DSP stage (called from PendSV_Handler)
 // ------------------------------------------------------------------------
-inline int32_t floatToInt32(float sample) {
-    // Clamp the value to the valid range [-1.0, 1.0]
-    if (sample > 1.0f) sample = 1.0f;
-    if (sample < -1.0f) sample = -1.0f;
+ITCM void AudioDeferredProcess(void) {
+    int8_t Slot;
+    while ((Slot = __DeferredAudio.BeginProcess()) != DadMisc::NO_AUDIO_SLOT) {
+        AudioCallback(__pSlotIn[Slot]->getBlock(AUDIO_BUFFER_SIZE), __pSlotOut[Slot]->getBlock(AUDIO_BUFFER_SIZE));
+        __DeferredAudio.EndProcess(Slot);
+    }
+}
 
-    // Convert to a signed 24-bit integer (scale by 2^23)
-    int32_t intSample = static_cast<int32_t>(sample * 8388608.0f);
+// ------------------------------------------------------------------------
+//  Callback for transmission complete
+// ------------------------------------------------------------------------
+ITCM void HAL_SAI_TxCpltCallback(SAI_HandleTypeDef *hsai) {
+    TransmitSlot(&txBuffer[SAI_HALF_BUFFER_SIZE]);
+}
 
-    // Ensure the result is in a valid 24-bit format
-    return intSample & 0xFFFFFF;
+// ------------------------------------------------------------------------
+//  Callback for half transmission complete
+// ------------------------------------------------------------------------
+ITCM void HAL_SAI_TxHalfCpltCallback(SAI_HandleTypeDef *hsai) {
+    TransmitSlot(txBuffer);
 }
 
-ITCM void ConvertFromAudioBuffer(AudioBuffer* floatBuf, int32_t* intBuf) {
-    for (size_t i = 0; i < AUDIO_BUFFER_SIZE; i++) {
-        intBuf[i * 2] = floatToInt32(floatBuf[i].Left);
-        intBuf[i * 2 + 1] = floatToInt32(floatBuf[i].Right);
-    }
+// ------------------------------------------------------------------------
+//  Callback for reception complete
+// ------------------------------------------------------------------------
+ITCM void HAL_SAI_RxCpltCallback(SAI_HandleTypeDef *hsai) {
+    CaptureSlot(1, &rxBuffer[SAI_HALF_BUFFER_SIZE]);
+}
+
+// ------------------------------------------------------------------------
+//  Callback for half reception complete
+// ------------------------------------------------------------------------
+ITCM void HAL_SAI_RxHalfCpltCallback(SAI_HandleTypeDef *hsai) {
+    CaptureSlot(0, rxBuffer);
 }
 
+#else
 // ------------------------------------------------------------------------
 //  Callback for transmission complete
 // ------------------------------------------------------------------------
 ITCM void HAL_SAI_TxCpltCallback(SAI_HandleTypeDef *hsai) {
     __disable_irq();
     // Convert audio buffer from float to int32_t format and store in the second half of txBuffer
-    ConvertFromAudioBuffer(pOut, &txBuffer[SAI_HALF_BUFFER_SIZE]);
+    ConvertFromAudioBuffer(*pOut, &txBuffer[SAI_HALF_BUFFER_SIZE]);
     __enable_irq();
 }
 
@@ -93,7 +161,7 @@ ITCM void HAL_SAI_TxCpltCallback(SAI_HandleTypeDef *hsai) {
 ITCM void HAL_SAI_TxHalfCpltCallback(SAI_HandleTypeDef *hsai) {
     __disable_irq();
     // Convert audio buffer from float to int32_t format and store in the first half of txBuffer
-    ConvertFromAudioBuffer(pOut, txBuffer);
+    ConvertFromAudioBuffer(*pOut, txBuffer);
     __enable_irq();
 }
 
@@ -105,9 +173,9 @@ ITCM void HAL_SAI_RxCpltCallback(SAI_HandleTypeDef *hsai) {
 	// Convert received int32_t buffer to float format for processing
     ConvertToAudioBuffer(&rxBuffer[SAI_HALF_BUFFER_SIZE], In);
     // Process audio data
-    AudioCallback(In, Out2);
+    AudioCallback(In.getBlock(AUDIO_BUFFER_SIZE), Out2.getBlock(AUDIO_BUFFER_SIZE));
     __disable_irq();
-    pOut = Out2;
+    pOut = &Out2;
     __enable_irq();
 }
 
@@ -118,12 +186,14 @@ ITCM void HAL_SAI_RxHalfCpltCallback(SAI_HandleTypeDef *hsai) {
 	// Convert received int32_t buffer to float format for processing
     ConvertToAudioBuffer(rxBuffer, In);
     // Process audio data
-    AudioCallback(In, Out1);
+    AudioCallback(In.getBlock(AUDIO_BUFFER_SIZE), Out1.getBlock(AUDIO_BUFFER_SIZE));
     __disable_irq();
-    pOut = Out1;
+    pOut = &Out1;
     __enable_irq();
 }
 
+#endif // AUDIO_DEFERRED
+
 // ------------------------------------------------------------------------
 // Start Audio Callback
 // ------------------------------------------------------------------------
@@ -131,16 +201,20 @@ HAL_StatusTypeDef StartAudio(){
 	HAL_StatusTypeDef Result;
 
 	// Buffers initialization
-	pOut=Out1;
-	for(uint16_t Index = 0; Index < AUDIO_BUFFER_SIZE; Index++ ){
-		In[Index].Left = 0.0f;
-		In[Index].Right = 0.0f;
-		Out1[Index].Left = 0.0f;
-		Out1[Index].Right = 0.0f;
-		Out2[Index].Left = 0.0f;
-		Out2[Index].Right = 0.0f;
-	}
-	for(uint16_t Index = 0; Index < SAI_BUFFER_SIZE; Index++ ){
+	pOut=&Out1;
+	In.Clear();
+	Out1.Clear();
+	Out2.Clear();
+#ifdef AUDIO_DEFERRED
+	In2.Clear();
+
+	// Deferred DSP stage: PendSV below the SAI DMA interrupts,
+	// deadline of one block period
+	HAL_NVIC_SetPriority(PendSV_IRQn, 15, 0);
+	DadMisc::cMonitor::initDWT();
+	__DeferredAudio.Init(ReadCycleCounter, (uint32_t)((SystemCoreClock / SAMPLING_RATE) * AUDIO_BUFFER_SIZE));
+#endif
+	for(uint16_t Index = 0; Index < SAI_BUFFER_SIZE_MAX; Index++ ){
 		rxBuffer[Index] = 0;
 		txBuffer[Index] = 0;
 	}
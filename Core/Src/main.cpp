@@ -29,6 +29,9 @@
 #include "QSPI.h"
 #include "PendaUI.h"
 #include "cMonitor.h"
+#include "cDeferredAudio.h"
+#include "cArena.h"
+#include "AudioBlock.h"
 #include "Effect.h"
 
 
@@ -119,7 +122,22 @@ DadMisc::cMonitor __Monitor;
 volatile float CPULoad;
 volatile float EffectTime;
 volatile float Frequency;
+#ifdef AUDIO_DEFERRED
+extern DadMisc::cDeferredAudio __DeferredAudio;
+volatile uint32_t XRunCount;
+volatile uint32_t DroppedCount;
+volatile uint32_t DeadlineMissCount;
+volatile uint32_t MaxLatency;
 #endif
+#ifdef PENDA_CHAIN
+volatile float SlotCPULoad[DadEffect::CHAIN_MAX_SLOTS];
+#endif
+#endif
+
+// Effect buffers arena (SDRAM), reset when the effect is replaced
+constexpr size_t EFFECT_ARENA_SIZE = 16 * 1024 * 1024;
+SDRAM_SECTION uint8_t __EffectArenaMemory[EFFECT_ARENA_SIZE];
+DadMisc::cArena __EffectArena;
 
 // Effect Manager
 EFFECT		__Effect;
@@ -133,29 +151,28 @@ uint32_t __CT=0; 			// Cycle counter
  	 	 	 	 	 	 	// - The LED blink rate indicates proper callback execution
 
 // ITCM: Optimized for fast execution (placed in Instruction Tightly Coupled Memory)
-ITCM void AudioCallback(AudioBuffer *pIn, AudioBuffer *pOut) {
+ITCM void AudioCallback(const AudioBlock &In, const AudioBlock &Out) {
 	#ifdef MONITOR
 	__Monitor.startMonitoring();
 	#endif
 
 	// Get the current ON/OFF state from the UI (real-time safe)
     eOnOff OnOff = DadUI::cPendaUI::RTProcess();
-    // Process each sample in the audio buffer
-    for (size_t i = 0; i < AUDIO_BUFFER_SIZE; i++) {
-    	// Detect state change only when audio is near silence (avoid clicks)
-        if ((OnOff != __MemOnOff) && (fabs(pIn->Right + pIn->Left) < 0.001f)) {
-            __MemOnOff = OnOff; // Update state if crossing threshold
-            DadUI::cPendaUI::m_Volumes.OnOffChange(__MemOnOff);
-        }
-
-        // Process effect
-        __Effect.Process(pIn, pOut, __MemOnOff);
 
-        // Advance buffer pointers (post-increment)
-    	pOut++;
-    	pIn++;
+    // Detect state change only when audio is near silence (avoid clicks)
+    if (OnOff != __MemOnOff) {
+        for (size_t i = 0; i < In.Size; i++) {
+            if (fabs(In.R(i) + In.L(i)) < 0.001f) {
+                __MemOnOff = OnOff; // Update state if crossing threshold
+                DadUI::cPendaUI::m_Volumes.OnOffChange(__MemOnOff);
+                break;
+            }
+        }
     }
 
+    // Process effect on the whole block
+    __Effect.Process(In, Out);
+
     // Increment cycle counter for visual feedback:
     __CT++;
 
@@ -341,10 +358,14 @@ int main(void)
   }
   pBack->eraseLayer(DadGFX::sColor(0,0,0,255));
 
+  // Audio block size (system setting, must be set before any rate-dependent initialization)
+  __AudioBufferSize = DadUI::cUIImputVolume::LoadAudioBufferSize();
+
   // GUI Initializations
   DadUI::cPendaUI::Init(EFFECT_NAME, EFFECT_VERSION, &huart1, &htim6);
 
   // Effect Initialization
+  __EffectArena.Init(__EffectArenaMemory, EFFECT_ARENA_SIZE);
   __Effect.Initialize();
 
   // Audio launch
@@ -366,10 +387,13 @@ int main(void)
     /* USER CODE BEGIN 3 */
 // =====** DAD **=================================================================
 	  DadUI::cPendaUI::Update(); 				// Update UI
+#ifdef PENDA_REGISTRY
+	  __Effect.Update();						// Apply an effect selection
+#endif
       __Display.flush();		 				// Update display
 
       // LED blinking: indicates that the audio loop is operating correctly.
-      if(__CT >= (uint32_t) (((float)SAMPLING_RATE / 4.0f)  * 0.5f)){
+      if(__CT >= (uint32_t) (UI_RT_SAMPLING_RATE * 0.5f)){
     	  __CT =0;
     	  HAL_GPIO_TogglePin(LED_GPIO_Port, LED_Pin);
       }
@@ -378,6 +402,18 @@ int main(void)
       EffectTime = __Monitor.getAverageExecutionTime_us();
       Frequency = __Monitor.getAverageFrequency_Hz();
       __Monitor.reset();
+#ifdef AUDIO_DEFERRED
+      XRunCount = __DeferredAudio.getXRunCount();
+      DroppedCount = __DeferredAudio.getDroppedCount();
+      DeadlineMissCount = __DeferredAudio.getDeadlineMissCount();
+      MaxLatency = __DeferredAudio.getMaxLatencyTicks();
+#endif
+#ifdef PENDA_CHAIN
+      for(uint8_t Slot = 0; Slot < __Effect.getNbSlots(); Slot++){
+    	  SlotCPULoad[Slot] = __Effect.getSlotMonitor(Slot).getCPULoad_percent();
+    	  __Effect.getSlotMonitor(Slot).reset();
+      }
+#endif
 #endif
 	  HAL_Delay(100);
 
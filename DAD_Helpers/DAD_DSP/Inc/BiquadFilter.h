@@ -7,6 +7,7 @@
 /* by Robert Bristow-Johnson  <rbj@audioimagination.com>                   */
 /***************************************************************************/
 #include "main.h"
+#include "AudioBlock.h"
 #include <cstdint>
 #include <cmath>
 
@@ -34,6 +35,23 @@ struct sFilterState{
 	float y2;
 };
 
+// Normalized coefficients (same layout as cBiQuad::m_a0..m_a4)
+struct sBiQuadCoefs{
+	float a0; // b0 / a0
+	float a1; // b1 / a0
+	float a2; // b2 / a0
+	float a3; // a1 / a0
+	float a4; // a2 / a0
+};
+
+// Transposed direct form II state of one stage, both channels
+struct sTDF2State{
+	float s1L;
+	float s2L;
+	float s1R;
+	float s2R;
+};
+
 enum class eChannel{
 	Left,
 	Right
@@ -46,13 +64,38 @@ public:
     void Initialize(float sampleRate, float cutoffFreq, float gainDb, float bandwidth, FilterType type);
 
     // ==========================================================================
-    // Calculate filter parameters
+    // Calculate filter parameters (from the audio context, or before the
+    // filter is processed)
     ITCM void CalculateParameters();
 
+    // ==========================================================================
+    // Control rate coefficient updates (block processing).
+    // RateHz = 0 (default): UpdateParameters() recalculates at once, as
+    // CalculateParameters(). Otherwise the coefficients of the last parameters
+    // are calculated at most RateHz times per second and reached by linear
+    // interpolation over the control period, one step per block (a straight
+    // line between two stable biquads stays stable).
+    void setControlRate(float RateHz);
+
+    // ==========================================================================
+    // Parameters changed (cheap when a control rate is set: called from
+    // parameter callbacks on every ramp step)
+    inline void UpdateParameters() {
+    	if (m_ControlPeriod == 0) {
+    		CalculateParameters();
+    	} else {
+    		m_UpdatePending = true;
+    	}
+    }
+
     // ==========================================================================
     // Calculate gain for a given frequency
     float GainDb(float freq);
 
+    // ==========================================================================
+    // Gains of Count frequencies (target coefficients of the current parameters)
+    void GainDb(const float *pFreq, float *pGainDb, size_t Count) const;
+
     // ==========================================================================
     // Process Filter
     inline float Process(float sample, eChannel Channel){
@@ -73,7 +116,13 @@ public:
     	}
     	return sample;
     }
-    
+
+    // ==========================================================================
+    // Process a stereo block (In and Out may be the same block).
+    // Transposed direct form II, both channels in one pass, with its own state:
+    // an instance is used either per sample or per block.
+    ITCM void Process(const AudioBlock &In, const AudioBlock &Out);
+
 
     // ==========================================================================
     // Set filter parameters
@@ -92,10 +141,32 @@ public:
     inline FilterType getType() { return m_type; }
 	
 protected:
+    friend class cBiQuadCascade;
+
+    // ==========================================================================
+    // |H|^2 of a set of coefficients, Phi = 4 * sin^2(pi * freq / sampleRate)
+    static inline float MagnitudeSquared(const sBiQuadCoefs &Coefs, float Phi) {
+    	float b = Coefs.a0 + Coefs.a1 + Coefs.a2;
+    	float a = 1.0f + Coefs.a3 + Coefs.a4;
+    	float num = (Coefs.a0 * Coefs.a2 * Phi * Phi) + (b * b)
+    	          - (((Coefs.a0 * Coefs.a1) + (4.0f * Coefs.a0 * Coefs.a2) + (Coefs.a1 * Coefs.a2)) * Phi);
+    	float denum = (Coefs.a4 * Phi * Phi) + (a * a)
+    	            - ((Coefs.a3 + (4.0f * Coefs.a4) + (Coefs.a3 * Coefs.a4)) * Phi);
+    	return num / denum;
+    }
+
     // ==========================================================================
     // Filter Mono or Stereo CH1 signal: must be called for each sample
     ITCM float Process(float sample, sFilterState &FilterState);
 
+    // ==========================================================================
+    // Coefficients of the current parameters (Cookbook formulae)
+    void ComputeCoefficients(sBiQuadCoefs &Coefs) const;
+
+    // ==========================================================================
+    // Control rate: next interpolation step, at the start of a block of nFrames
+    ITCM void StepCoefficients(size_t nFrames);
+
     // Filter parameters
     float m_sampleRate;
     float m_cutoffFreq;
@@ -111,10 +182,65 @@ protected:
     float m_a2 = 0;
     float m_a3 = 0;
     float m_a4 = 0;
+    bool  m_Cascade = false;	// LPF24/HPF24: two identical stages
 	
     // Previous samples storage
     sFilterState	m_FilterState[4]={};
+    sTDF2State		m_BlockState[2]={};	// Block processing, one per stage
+
+    // Control rate updates
+    uint32_t		m_ControlPeriod = 0;	// Frames between two calculations (0: immediate)
+    uint32_t		m_RampFrames = 0;		// Frames left to reach m_TargetCoefs
+    bool			m_UpdatePending = false;
+    sBiQuadCoefs	m_TargetCoefs = {};
     
 
 };
+
+// ==========================================================================
+// Cascade of second order sections (parametric EQ)
+//
+// The sections are cBiQuad (parameters, Cookbook coefficients, control rate);
+// the cascade processes them as one kernel over the block: every section on
+// each frame, so the block is read and written once and the coefficients and
+// states are gathered once per block. LPF24/HPF24 sections count as two stages.
+constexpr uint8_t BIQUAD_CASCADE_MAX = 8;		// Maximum number of sections
+
+class cBiQuadCascade {
+public:
+    // ==========================================================================
+    // Empty cascade
+    void Initialize(float sampleRate);
+
+    // ==========================================================================
+    // Adds a section, returns nullptr if the cascade is full
+    cBiQuad *addSection(float cutoffFreq, float gainDb, float bandwidth, FilterType type);
+
+    // ==========================================================================
+    // Sections (parameters are changed with setXxx() then UpdateParameters())
+    inline cBiQuad &getSection(uint8_t Index) { return m_Sections[Index]; }
+    inline uint8_t getNbSections() const { return m_NbSections; }
+
+    // ==========================================================================
+    // Control rate of all the sections (see cBiQuad::setControlRate)
+    void setControlRate(float RateHz);
+
+    // ==========================================================================
+    // Clears the filter states
+    void Clear();
+
+    // ==========================================================================
+    // Process a stereo block (In and Out may be the same block)
+    ITCM void Process(const AudioBlock &In, const AudioBlock &Out);
+
+    // ==========================================================================
+    // Gains of the whole cascade at Count frequencies (one log per frequency)
+    void GainDb(const float *pFreq, float *pGainDb, size_t Count) const;
+
+protected:
+    float	m_sampleRate = 48000.0f;
+    cBiQuad	m_Sections[BIQUAD_CASCADE_MAX];
+    uint8_t	m_NbSections = 0;
+};
+
 } // namespace DadDSP
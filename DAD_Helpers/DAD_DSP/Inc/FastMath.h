@@ -0,0 +1,285 @@
+#pragma once
+//====================================================================================
+//
+// File: FastMath.h
+// Description: Single precision approximations of the libm functions used by the
+//              DSP and the user interface.
+//
+//              Each function reduces its argument with exact float operations
+//              (power of two split, Cody-Waite reduction by ln(2), log10(2) or
+//              pi/2 in two or three parts) then evaluates a short polynomial
+//              (Cephes single precision minimax coefficients). Unlike libm they
+//              are inlined, without errno / special value handling and without
+//              double precision (pow(10, float) is a double call).
+//
+//              Max error against double precision, measured by penda_bench -f
+//              (rel = relative, abs = absolute below 1 and relative above):
+//                FastExp2      rel 1.0e-7    x in [-126, 127]
+//                FastExp       rel 1.2e-7    x in [-87, 88]
+//                FastPow10     rel 1.2e-7    x in [-37, 38]
+//                DbToLinear    rel 1.1e-7    dB in [-740, 760]
+//                FastLog2      abs 7.6e-8    x > 0 normal
+//                FastLog       abs 1.1e-7    x > 0 normal
+//                FastLog10     abs 1.6e-7    x > 0 normal
+//                LinearToDb    abs 2.4e-7    x > 0 normal
+//                FastSin/Cos   abs 9.3e-8    |x| < 8192
+//                FastTan       rel 1.7e-7    |x| < 1.5
+//                FastTanh      abs 8.9e-8    any x
+//                FastSinh      rel 1.4e-7    |x| < 87
+//              The arguments are clamped to these domains for the exponentials;
+//              out of them the results are not defined (no NaN, infinity or
+//              denormal handling).
+//
+// Copyright (c) 2025 Dad Design.
+//
+//====================================================================================
+#include <cstdint>
+#include <cstring>
+
+namespace DadDSP {
+
+// --------------------------------------------------------------------------
+// Bit casts
+inline uint32_t FloatToBits(float Value) {
+    uint32_t Bits;
+    memcpy(&Bits, &Value, sizeof(Bits));
+    return Bits;
+}
+
+inline float BitsToFloat(uint32_t Bits) {
+    float Value;
+    memcpy(&Value, &Bits, sizeof(Value));
+    return Value;
+}
+
+// --------------------------------------------------------------------------
+// Nearest integer of |x| < 2^22 (halves to even), without branch nor float to
+// int conversion: adding 1.5 * 2^23 rounds x in the low bits of the mantissa
+inline int32_t RoundToInt(float x) {
+    return static_cast<int32_t>(FloatToBits(x + 12582912.0f) - 0x4B400000u);
+}
+
+// --------------------------------------------------------------------------
+// 2^x, x in [-126, 127]
+inline float FastExp2(float x) {
+    x = (x < -126.0f) ? -126.0f : ((x > 127.0f) ? 127.0f : x);
+    const int32_t Exponent = RoundToInt(x);
+    const float f = x - static_cast<float>(Exponent);         // [-0.5, 0.5], exact
+
+    // 2^f = 1 + f * P(f)
+    float p = 1.535336188319500e-4f;
+    p = (p * f) + 1.339887440266574e-3f;
+    p = (p * f) + 9.618437357674640e-3f;
+    p = (p * f) + 5.550332471162809e-2f;
+    p = (p * f) + 2.402264791363012e-1f;
+    p = (p * f) + 6.931472028550421e-1f;
+    const float Mantissa = 1.0f + (f * p);
+
+    return Mantissa * BitsToFloat(static_cast<uint32_t>(Exponent + 127) << 23);
+}
+
+// --------------------------------------------------------------------------
+// log2(x), x > 0 normal
+inline float FastLog2(float x) {
+    // x = m * 2^e, m in [sqrt(1/2), sqrt(2)[
+    const uint32_t Bits = FloatToBits(x);
+    int32_t Exponent = static_cast<int32_t>((Bits >> 23) & 0xFF) - 127;
+    float m = BitsToFloat((Bits & 0x007FFFFFu) | 0x3F800000u);
+    if (m > 1.41421356f) {
+        m *= 0.5f;
+        Exponent++;
+    }
+
+    // ln(1 + r) = r - r^2/2 + r^3 * P(r)
+    const float r = m - 1.0f;
+    const float z = r * r;
+    float p = 7.0376836292e-2f;
+    p = (p * r) - 1.1514610310e-1f;
+    p = (p * r) + 1.1676998740e-1f;
+    p = (p * r) - 1.2420140846e-1f;
+    p = (p * r) + 1.4249322787e-1f;
+    p = (p * r) - 1.6668057665e-1f;
+    p = (p * r) + 2.0000714765e-1f;
+    p = (p * r) - 2.4999993993e-1f;
+    p = (p * r) + 3.3333331174e-1f;
+    const float Ln = r + ((r * z * p) - (0.5f * z));
+
+    return static_cast<float>(Exponent) + (Ln * 1.44269504088896341f);
+}
+
+// --------------------------------------------------------------------------
+// e^x, x in [-87, 88] (reduced by ln(2) in two parts: x = r + n * ln(2))
+inline float FastExp(float x) {
+    x = (x < -87.0f) ? -87.0f : ((x > 88.0f) ? 88.0f : x);
+    const int32_t Exponent = RoundToInt(x * 1.44269504088896341f);
+    const float n = static_cast<float>(Exponent);
+    const float r = (x - (n * 0.693359375f)) + (n * 2.12194440e-4f);
+
+    // e^r = 1 + r + r^2 * P(r)
+    float p = 1.9875691500e-4f;
+    p = (p * r) + 1.3981999507e-3f;
+    p = (p * r) + 8.3334519073e-3f;
+    p = (p * r) + 4.1665795894e-2f;
+    p = (p * r) + 1.6666665459e-1f;
+    p = (p * r) + 5.0000001201e-1f;
+    const float Mantissa = (1.0f + r) + (r * r * p);
+
+    // 2^n in two factors (n reaches 128 for x near 88)
+    const int32_t Half = Exponent >> 1;
+    return Mantissa * BitsToFloat(static_cast<uint32_t>(Half + 127) << 23)
+                    * BitsToFloat(static_cast<uint32_t>(Exponent - Half + 127) << 23);
+}
+
+// --------------------------------------------------------------------------
+// ln(x), x > 0 normal
+inline float FastLog(float x) { return FastLog2(x) * 0.693147180559945309f; }
+
+// --------------------------------------------------------------------------
+// 10^r, r in [-log10(2)/2, log10(2)/2]: 1 + r * P(r)
+inline float Pow10Poly(float r) {
+    float p = 2.063216740311022e-1f;
+    p = (p * r) + 5.420251702225484e-1f;
+    p = (p * r) + 1.171292686296281e+0f;
+    p = (p * r) + 2.034649854009453e+0f;
+    p = (p * r) + 2.650948748208892e+0f;
+    p = (p * r) + 2.302585167056758e+0f;
+    return 1.0f + (r * p);
+}
+
+// --------------------------------------------------------------------------
+// 10^x, x in [-37, 38] (reduced by log10(2) in two parts: x = r + n * log10(2))
+inline float FastPow10(float x) {
+    x = (x < -37.0f) ? -37.0f : ((x > 38.0f) ? 38.0f : x);
+    const int32_t Exponent = RoundToInt(x * 3.32192809488736235f);
+    const float n = static_cast<float>(Exponent);
+    const float r = (x - (n * 3.00781250e-1f)) - (n * 2.48745663981195214e-4f);
+    return Pow10Poly(r) * BitsToFloat(static_cast<uint32_t>(Exponent + 127) << 23);
+}
+
+// --------------------------------------------------------------------------
+// log10(x), x > 0 normal
+inline float FastLog10(float x) { return FastLog2(x) * 0.301029995663981195f; }
+
+// --------------------------------------------------------------------------
+// Gain of a level in dB, dB in [-740, 760] (reduced in dB, by 20 * log10(2)
+// in two parts, so that the scaling by 1/20 only rounds the small remainder)
+inline float DbToLinear(float dB) {
+    dB = (dB < -740.0f) ? -740.0f : ((dB > 760.0f) ? 760.0f : dB);
+    const int32_t Exponent = RoundToInt(dB * 0.166096404744368118f);
+    const float n = static_cast<float>(Exponent);
+    const float r = ((dB - (n * 6.015625f)) - (n * 4.97491327962390e-3f)) * 0.05f;
+    return Pow10Poly(r) * BitsToFloat(static_cast<uint32_t>(Exponent + 127) << 23);
+}
+
+// --------------------------------------------------------------------------
+// Level in dB of a gain, x > 0 normal
+inline float LinearToDb(float x) { return FastLog2(x) * (20.0f * 0.301029995663981195f); }
+
+// --------------------------------------------------------------------------
+// Quadrant reduction: x = r + Quadrant * pi/2, r in [-pi/4, pi/4]
+// (pi/2 in three parts, the products by Quadrant are exact for |x| < 8192)
+inline float ReduceQuadrant(float x, int32_t &Quadrant) {
+    Quadrant = RoundToInt(x * 0.636619772367581343f);
+    const float q = static_cast<float>(Quadrant);
+    return ((x - (q * 1.5703125f)) - (q * 4.837512969970703125e-4f)) - (q * 7.54978995489188216e-8f);
+}
+
+// Sine and cosine of r in [-pi/4, pi/4]
+inline float SinPoly(float r) {
+    const float z = r * r;
+    float p = -1.9515295891e-4f;
+    p = (p * z) + 8.3321608736e-3f;
+    p = (p * z) - 1.6666654611e-1f;
+    return r + (r * z * p);
+}
+
+inline float CosPoly(float r) {
+    const float z = r * r;
+    float p = 2.443315711809948e-5f;
+    p = (p * z) - 1.388731625493765e-3f;
+    p = (p * z) + 4.166664568298827e-2f;
+    return (1.0f - (0.5f * z)) + (z * z * p);
+}
+
+// --------------------------------------------------------------------------
+// Sine and cosine of x (radians), |x| < 8192
+inline void FastSinCos(float x, float &Sin, float &Cos) {
+    int32_t Quadrant;
+    const float r = ReduceQuadrant(x, Quadrant);
+    const float s = SinPoly(r);
+    const float c = CosPoly(r);
+    switch (Quadrant & 3) {
+    case 0:  Sin = s;  Cos = c;  break;
+    case 1:  Sin = c;  Cos = -s; break;
+    case 2:  Sin = -s; Cos = -c; break;
+    default: Sin = -c; Cos = s;  break;
+    }
+}
+
+inline float FastSin(float x) {
+    int32_t Quadrant;
+    const float r = ReduceQuadrant(x, Quadrant);
+    const float Value = (Quadrant & 1) ? CosPoly(r) : SinPoly(r);
+    return (Quadrant & 2) ? -Value : Value;
+}
+
+inline float FastCos(float x) {
+    int32_t Quadrant;
+    const float r = ReduceQuadrant(x, Quadrant);
+    const float Value = (Quadrant & 1) ? SinPoly(r) : CosPoly(r);
+    return ((Quadrant + 1) & 2) ? -Value : Value;
+}
+
+// --------------------------------------------------------------------------
+// Tangent of x (radians), |x| < 8192
+inline float FastTan(float x) {
+    int32_t Quadrant;
+    const float r = ReduceQuadrant(x, Quadrant);
+    const float z = r * r;
+    float p = 9.38540185543e-3f;
+    p = (p * z) + 3.11992232697e-3f;
+    p = (p * z) + 2.44301354525e-2f;
+    p = (p * z) + 5.34112807005e-2f;
+    p = (p * z) + 1.33387994085e-1f;
+    p = (p * z) + 3.33331568548e-1f;
+    const float Value = r + (r * z * p);
+    return (Quadrant & 1) ? (-1.0f / Value) : Value;
+}
+
+// --------------------------------------------------------------------------
+// Hyperbolic tangent of x
+inline float FastTanh(float x) {
+    const float Abs = (x < 0.0f) ? -x : x;
+    if (Abs < 0.625f) {
+        // tanh(x) = x + x^3 * P(x^2)
+        const float z = x * x;
+        float p = -5.70498872745e-3f;
+        p = (p * z) + 2.06390887954e-2f;
+        p = (p * z) - 5.37397155531e-2f;
+        p = (p * z) + 1.33314422036e-1f;
+        p = (p * z) - 3.33332819422e-1f;
+        return x + (x * z * p);
+    }
+    // tanh(|x|) = 1 - 2 / (e^2|x| + 1)
+    const float Value = (Abs > 10.0f) ? 1.0f : 1.0f - (2.0f / (FastExp2(Abs * 2.88539008177792682f) + 1.0f));
+    return (x < 0.0f) ? -Value : Value;
+}
+
+// --------------------------------------------------------------------------
+// Hyperbolic sine of x, |x| < 87
+inline float FastSinh(float x) {
+    const float Abs = (x < 0.0f) ? -x : x;
+    if (Abs <= 1.0f) {
+        // sinh(x) = x + x^3 * P(x^2)
+        const float z = x * x;
+        float p = 2.03721912945e-4f;
+        p = (p * z) + 8.33028376239e-3f;
+        p = (p * z) + 1.66667160211e-1f;
+        return x + (x * z * p);
+    }
+    const float Exp = FastExp(Abs);
+    const float Value = 0.5f * (Exp - (1.0f / Exp));
+    return (x < 0.0f) ? -Value : Value;
+}
+
+} // DadDSP
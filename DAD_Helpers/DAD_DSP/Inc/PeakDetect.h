@@ -5,6 +5,7 @@
 #pragma once
 
 #include <math.h>
+#include "FastMath.h"
 
 namespace DadDSP {
 
@@ -48,7 +49,7 @@ namespace DadDSP {
 			else {
 				m_Meter -= m_CtIntegration;
 			}
-			return pow(10, m_Meter)/10;
+			return FastPow10(m_Meter) * 0.1f;
 		}
 	protected:
 		float m_Meter=0;
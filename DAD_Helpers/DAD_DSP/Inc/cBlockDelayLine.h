@@ -0,0 +1,375 @@
+#pragma once
+//====================================================================================
+//
+// File: cBlockDelayLine.h
+// Description: Delay line with a power of two capacity, for block processing.
+//
+//              The write index wraps with a mask instead of a compare, and a
+//              block is written (or read at a fixed delay) as at most two
+//              contiguous spans, split where the ring wraps.
+//
+// Usage:
+//   - Allocate getCapacity(maxDelay) samples and call `Initialize()`.
+//   - Per block: `Read()` the delayed frames, then `Write()` the new ones.
+//   - `ReadTaps()` reads many taps of a block in one pass (multi-tap delays).
+//   - `Push()` / `Pull()` remain available per sample, as cDelayLine.
+//   - The interpolator is a policy (cInterpolator.h), e.g.
+//     cBlockDelayLine<cHermiteInterpolator>: it is inlined in the read loop.
+//   - The sample storage is a policy too (cDelayStorage.h): float by default,
+//     int16 or packed int24 for long delays. Allocate getCells(Capacity)
+//     cells of tCell.
+//   - Block reads and writes go through __DelayStage (DTCM): the ring (in
+//     SDRAM) is only accessed in ascending contiguous spans, the interpolation
+//     loops run on the stage.
+//
+// Notes:
+//   - Delays are counted as in cDelayLine: a delay of 0 is the last sample
+//     written. Read() counts the delay of frame i from the last sample written
+//     plus i, so a block read before the block is written needs delays of at
+//     least the block size.
+//   - Interpolated delays must be at least kMinDelay (of the interpolator).
+//
+// Copyright (c) 2025 Dad Design.
+//
+//====================================================================================
+#include "main.h"
+#include "cInterpolator.h"
+#include "cDelayStorage.h"
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+
+namespace DadDSP {
+
+//***********************************************************************************
+// class cBlockDelayLine
+// Input -> XXXXXXXXXX -> Output, capacity 2^n
+//***********************************************************************************
+template<typename tInterpolator = cLinearInterpolator, typename tStorage = cFloatStorage>
+class cBlockDelayLine
+{
+public:
+    // Cell of the ring buffer
+    using tCell = typename tStorage::tCell;
+
+    // Smallest interpolated delay
+    static constexpr uint32_t kMinDelay = tInterpolator::kMinDelay;
+
+    // --------------------------------------------------------------------------
+    // Constructor / destructor
+    cBlockDelayLine() {};
+
+    ~cBlockDelayLine() {};
+
+    // --------------------------------------------------------------------------
+    // Capacity (samples to allocate) for delays up to maxDelay samples
+    // (4-point interpolation reads two samples further)
+    static constexpr uint32_t getCapacity(uint32_t maxDelay) {
+        uint32_t Capacity = 1;
+        while (Capacity < (maxDelay + 3)) {
+            Capacity <<= 1;
+        }
+        return Capacity;
+    }
+
+    // --------------------------------------------------------------------------
+    // Cells (of tCell) to allocate for a capacity
+    static constexpr size_t getCells(uint32_t Capacity) {
+        return tStorage::getCells(Capacity);
+    }
+
+    // --------------------------------------------------------------------------
+    // Initializes the ring buffer (a capacity which is not a power of two is
+    // rounded down to one)
+    void Initialize(tCell* buffer, uint32_t capacity) {
+        uint32_t Capacity = 1;
+        while (((Capacity << 1) != 0) && ((Capacity << 1) <= capacity)) {
+            Capacity <<= 1;
+        }
+        m_Buffer = buffer;
+        m_Mask = Capacity - 1;
+        m_CurrentIndex = 0;
+        m_Interpolator.Clear();
+        m_TapInterpolator.Clear();
+    }
+
+    // --------------------------------------------------------------------------
+    // Clears the ring buffer
+    void Clear() {
+        if (m_Buffer) {
+            memset(m_Buffer, 0, (tStorage::getCells(m_Mask + 1) * sizeof(tCell)));
+        }
+        m_Interpolator.Clear();
+        m_TapInterpolator.Clear();
+    }
+
+    // --------------------------------------------------------------------------
+    // Adds an element to the delay line
+    inline void Push(float inputSample) {
+        if (m_Buffer) {
+            m_CurrentIndex = (m_CurrentIndex + 1) & m_Mask;
+            tStorage::Store(m_Buffer, m_CurrentIndex, inputSample);
+        }
+    }
+
+    // --------------------------------------------------------------------------
+    // Retrieves a sample without interpolation
+    inline float Pull(int32_t delay) {
+        if (m_Buffer) {
+            return tStorage::Load(m_Buffer, (m_CurrentIndex - delay) & m_Mask);
+        }
+        else return 0.0f;
+    }
+
+    // --------------------------------------------------------------------------
+    // Retrieves a sample with interpolation
+    // (delay >= 0: the conversion truncates to the floor)
+    inline float Pull(float delay) {
+        if (m_Buffer) {
+            int32_t IntDelay = static_cast<int32_t>(delay);
+            float interpFactor = delay - static_cast<float>(IntDelay);
+            return m_Interpolator.Interpolate(Samples(), m_Mask, (m_CurrentIndex - IntDelay) & m_Mask, interpFactor);
+        }
+        else return 0.0f;
+    }
+
+    // --------------------------------------------------------------------------
+    // Adds nFrames samples (as nFrames Push())
+    // A converted storage (int16, int24) converts the block in the DTCM stage
+    // and copies it to the ring as contiguous words.
+    void Write(const float* pIn, size_t nFrames) {
+        if ((m_Buffer == nullptr) || (nFrames == 0)) {
+            return;
+        }
+        uint32_t Start = (m_CurrentIndex + 1) & m_Mask;
+        size_t Span = (m_Mask + 1) - Start;     // Samples before the wrap
+        if (tStorage::kDirectWrite || (nFrames > AUDIO_BUFFER_SIZE_MAX)) {
+            if (nFrames <= Span) {
+                StoreSpan(Start, pIn, nFrames);
+            } else {
+                StoreSpan(Start, pIn, Span);
+                StoreSpan(0, &pIn[Span], nFrames - Span);
+            }
+        } else {
+            constexpr uint32_t Cells = tStorage::kCellsPerSample;
+            tCell* pStage = reinterpret_cast<tCell*>(__DelayStage.Cells);
+            for (size_t Index = 0; Index < nFrames; Index++) {
+                tStorage::Store(pStage, static_cast<uint32_t>(Index), pIn[Index]);
+            }
+            if (nFrames <= Span) {
+                tStorage::CopyCells(&m_Buffer[Start * Cells], pStage, nFrames * Cells);
+            } else {
+                tStorage::CopyCells(&m_Buffer[Start * Cells], pStage, Span * Cells);
+                tStorage::CopyCells(m_Buffer, &pStage[Span * Cells], (nFrames - Span) * Cells);
+            }
+        }
+        m_CurrentIndex = (m_CurrentIndex + static_cast<uint32_t>(nFrames)) & m_Mask;
+    }
+
+    // --------------------------------------------------------------------------
+    // Reads nFrames samples at a fixed delay: pOut[i] = Pull(delay - i)
+    void Read(float* pOut, uint32_t delay, size_t nFrames) {
+        if (m_Buffer == nullptr) {
+            memset(pOut, 0, nFrames * sizeof(float));
+            return;
+        }
+        LoadRing(pOut, (m_CurrentIndex - delay) & m_Mask, nFrames);
+    }
+
+    // --------------------------------------------------------------------------
+    // Reads nFrames samples at the delay of every frame, with interpolation:
+    // pOut[i] = Pull(pDelays[i] - i)
+    // The span the block reads is loaded in the DTCM stage in one pass, then
+    // interpolated from there. Delays moving by more than a sample per frame
+    // fall back to a gather per frame.
+    void Read(float* pOut, const float* pDelays, size_t nFrames) {
+        if (m_Buffer == nullptr) {
+            memset(pOut, 0, nFrames * sizeof(float));
+            return;
+        }
+        int32_t Offset[AUDIO_BUFFER_SIZE_MAX];
+        float   Frac[AUDIO_BUFFER_SIZE_MAX];
+        int32_t Low;
+        const size_t Span = getSpan(pDelays, nFrames, Offset, Frac, Low);
+        if (Span == 0) {
+            GatherRead(pOut, pDelays, nFrames);
+            return;
+        }
+
+        // One interpolation per frame in the stage (it does not wrap: full mask)
+        float* const pStage = __DelayStage.Samples;
+        LoadRing(pStage, (m_CurrentIndex + Low) & m_Mask, Span);
+        tInterpolator Interpolator = m_Interpolator;
+        for (size_t Frame = 0; Frame < nFrames; Frame++) {
+            pOut[Frame] = Interpolator.Interpolate(pStage, 0xFFFFFFFF, static_cast<uint32_t>(Offset[Frame] - Low), Frac[Frame]);
+        }
+        m_Interpolator = Interpolator;
+    }
+
+    // --------------------------------------------------------------------------
+    // Reads NbTaps taps of every frame, mixed with their gains:
+    // pOut[i] = sum of pGains[t] * Pull(pTaps[t] + pDelays[i] - i)
+    // pTaps  : integer delays of the taps, ascending
+    // pDelays: delay of every frame added to all the taps (modulation)
+    // The taps share the index and fraction of a frame: the line is mixed
+    // first in the DTCM stage, tap by tap over the contiguous span the block
+    // reads (split at the wrap), then the mix is interpolated once per frame.
+    // Delays moving by more than a sample per frame fall back to a gather per
+    // frame.
+    void ReadTaps(float* pOut, const float* pDelays, const uint32_t* pTaps, const float* pGains,
+                  size_t NbTaps, size_t nFrames) {
+        if (m_Buffer == nullptr) {
+            memset(pOut, 0, nFrames * sizeof(float));
+            return;
+        }
+        int32_t Offset[AUDIO_BUFFER_SIZE_MAX];
+        float   Frac[AUDIO_BUFFER_SIZE_MAX];
+        int32_t Low;
+        const size_t Span = getSpan(pDelays, nFrames, Offset, Frac, Low);
+        if (Span == 0) {
+            GatherTaps(pOut, pDelays, pTaps, pGains, NbTaps, nFrames);
+            return;
+        }
+
+        // Mix of the taps over the span
+        float* const Mix = __DelayStage.Samples;
+        memset(Mix, 0, Span * sizeof(float));
+        const uint32_t Capacity = m_Mask + 1;
+        for (size_t Tap = 0; Tap < NbTaps; Tap++) {
+            const float Gain = pGains[Tap];
+            const uint32_t Start = (m_CurrentIndex + Low - pTaps[Tap]) & m_Mask;
+            const size_t First = ((Capacity - Start) < Span) ? (Capacity - Start) : Span;
+            for (size_t Index = 0; Index < First; Index++) {
+                Mix[Index] += Gain * tStorage::Load(m_Buffer, Start + Index);
+            }
+            for (size_t Index = First; Index < Span; Index++) {
+                Mix[Index] += Gain * tStorage::Load(m_Buffer, Index - First);
+            }
+        }
+
+        // One interpolation per frame (the mix does not wrap: full mask)
+        tInterpolator Interpolator = m_TapInterpolator;
+        for (size_t Frame = 0; Frame < nFrames; Frame++) {
+            pOut[Frame] = Interpolator.Interpolate(Mix, 0xFFFFFFFF, static_cast<uint32_t>(Offset[Frame] - Low), Frac[Frame]);
+        }
+        m_TapInterpolator = Interpolator;
+    }
+
+    // --------------------------------------------------------------------------
+    // Getters
+    inline uint32_t getCapacity() const { return m_Mask + 1; }
+
+private:
+    // --------------------------------------------------------------------------
+    // Sample read by every frame (pOffset, relative to the current index) and
+    // its fraction (pFrac). Returns the span of the block from Low, with the
+    // 4-point neighbourhood, or 0 if it does not fit the stage.
+    size_t getSpan(const float* pDelays, size_t nFrames, int32_t* pOffset, float* pFrac, int32_t& Low) const {
+        if (nFrames > AUDIO_BUFFER_SIZE_MAX) {
+            return 0;
+        }
+        int32_t High = 0;
+        Low = 0;
+        for (size_t Frame = 0; Frame < nFrames; Frame++) {
+            int32_t IntDelay = static_cast<int32_t>(pDelays[Frame]);
+            pFrac[Frame] = pDelays[Frame] - static_cast<float>(IntDelay);
+            pOffset[Frame] = static_cast<int32_t>(Frame) - IntDelay;
+            Low = ((Frame == 0) || (pOffset[Frame] < Low)) ? pOffset[Frame] : Low;
+            High = ((Frame == 0) || (pOffset[Frame] > High)) ? pOffset[Frame] : High;
+        }
+        Low -= 2;
+        High += 1;
+        const size_t Span = static_cast<size_t>(High - Low + 1);
+        return (Span <= DELAY_STAGE_SPAN) ? Span : 0;
+    }
+
+    // --------------------------------------------------------------------------
+    // Read with interpolation, gathering the samples of every frame in the ring
+    void GatherRead(float* pOut, const float* pDelays, size_t nFrames) {
+        const sStorageReader<tStorage> Buffer = Samples();
+        const uint32_t Mask = m_Mask;
+        const uint32_t Current = m_CurrentIndex;
+        tInterpolator Interpolator = m_Interpolator;
+        for (size_t Frame = 0; Frame < nFrames; Frame++) {
+            int32_t IntDelay = static_cast<int32_t>(pDelays[Frame]);
+            float interpFactor = pDelays[Frame] - static_cast<float>(IntDelay);
+            uint32_t Index = (Current + static_cast<uint32_t>(Frame) - IntDelay) & Mask;
+            pOut[Frame] = Interpolator.Interpolate(Buffer, Mask, Index, interpFactor);
+        }
+        m_Interpolator = Interpolator;
+    }
+
+    // --------------------------------------------------------------------------
+    // ReadTaps, gathering the 4 samples around every tap of every frame
+    void GatherTaps(float* pOut, const float* pDelays, const uint32_t* pTaps, const float* pGains,
+                    size_t NbTaps, size_t nFrames) {
+        const sStorageReader<tStorage> Buffer = Samples();
+        const uint32_t Mask = m_Mask;
+        const uint32_t Current = m_CurrentIndex;
+        tInterpolator Interpolator = m_TapInterpolator;
+        for (size_t Frame = 0; Frame < nFrames; Frame++) {
+            int32_t IntDelay = static_cast<int32_t>(pDelays[Frame]);
+            float interpFactor = pDelays[Frame] - static_cast<float>(IntDelay);
+            uint32_t Base = Current + static_cast<uint32_t>(Frame) - IntDelay;
+
+            // Weighted sums as a 4 sample ring around index 1
+            float Points[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+            for (size_t Tap = 0; Tap < NbTaps; Tap++) {
+                uint32_t Index = Base - pTaps[Tap];
+                float Gain = pGains[Tap];
+                Points[2] += Gain * Buffer[(Index + 1) & Mask];
+                Points[1] += Gain * Buffer[Index & Mask];
+                Points[0] += Gain * Buffer[(Index - 1) & Mask];
+                Points[3] += Gain * Buffer[(Index - 2) & Mask];
+            }
+            pOut[Frame] = Interpolator.Interpolate(Points, 3, 1, interpFactor);
+        }
+        m_TapInterpolator = Interpolator;
+    }
+
+    // --------------------------------------------------------------------------
+    // Ring buffer as an interpolator source
+    inline sStorageReader<tStorage> Samples() const {
+        return sStorageReader<tStorage>{m_Buffer};
+    }
+
+    // --------------------------------------------------------------------------
+    // Stores / loads a contiguous span from Start (plain loops: spans are a
+    // block or less, below the size where a memcpy call pays off)
+    inline void StoreSpan(uint32_t Start, const float* pIn, size_t Count) {
+        for (size_t Index = 0; Index < Count; Index++) {
+            tStorage::Store(m_Buffer, Start + static_cast<uint32_t>(Index), pIn[Index]);
+        }
+    }
+
+    inline void LoadSpan(float* pOut, uint32_t Start, size_t Count) const {
+        for (size_t Index = 0; Index < Count; Index++) {
+            pOut[Index] = tStorage::Load(m_Buffer, Start + static_cast<uint32_t>(Index));
+        }
+    }
+
+    // --------------------------------------------------------------------------
+    // Loads Count samples from Start, split where the ring wraps
+    inline void LoadRing(float* pOut, uint32_t Start, size_t Count) const {
+        size_t Span = (m_Mask + 1) - Start;     // Samples before the wrap
+        if (Count <= Span) {
+            LoadSpan(pOut, Start, Count);
+        } else {
+            LoadSpan(pOut, Start, Span);
+            LoadSpan(&pOut[Span], 0, Count - Span);
+        }
+    }
+
+    // --------------------------------------------------------------------------
+    // Data Members
+    //
+
+    tCell*    m_Buffer = nullptr;   // Pointer to allocated memory
+    uint32_t  m_Mask = 0;           // Capacity - 1
+    uint32_t  m_CurrentIndex = 0;   // Current index (zero delay position)
+    tInterpolator m_Interpolator;   // Fractional delay interpolation (policy)
+    tInterpolator m_TapInterpolator;// Interpolation of the mixed taps
+};
+
+} // DadDSP
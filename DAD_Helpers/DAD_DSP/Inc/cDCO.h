@@ -3,11 +3,49 @@
 // File: DigitalOscillator.h
 // Description:
 // Digital Controlled Oscillator (DCO) implementation
+//
+// The phase is a uint32 accumulator (one period = 2^32): it wraps for free and
+// phase offsets are exact integer adds. The sine outputs are read from a table
+// with linear interpolation (DCO_SINE_SIZE points, error near -100 dB of the
+// full scale), the other shapes are computed from the phase.
 //====================================================================================
 #include <cstdint>
 #include <cmath>
 
 namespace DadDSP {
+
+	// Sine table: one period in DCO_SINE_SIZE points, plus a guard point
+	constexpr uint32_t DCO_SINE_BITS = 9;
+	constexpr uint32_t DCO_SINE_SIZE = 1 << DCO_SINE_BITS;
+
+	struct sDCOSineTable {
+		float Value[DCO_SINE_SIZE + 1];
+	};
+
+	// --------------------------------------------------------------------------
+	// Sine of x in [-pi, pi] (Taylor series, double precision, compile time)
+	constexpr double DCOSine(double x) {
+		double Term = x;
+		double Sum = x;
+		for (int n = 1; n < 20; n++) {
+			Term *= -(x * x) / ((2.0 * n) * ((2.0 * n) + 1.0));
+			Sum += Term;
+		}
+		return Sum;
+	}
+
+	constexpr sDCOSineTable MakeDCOSineTable() {
+		constexpr double PI = 3.14159265358979323846;
+		sDCOSineTable Table = {};
+		for (uint32_t Index = 0; Index <= DCO_SINE_SIZE; Index++) {
+			double x = (2.0 * PI * Index) / DCO_SINE_SIZE;
+			Table.Value[Index] = static_cast<float>(DCOSine((x > PI) ? x - (2.0 * PI) : x));
+		}
+		return Table;
+	}
+
+	inline constexpr sDCOSineTable __DCOSineTable = MakeDCOSineTable();
+
 	//***********************************************************************************
 	//  cDCO
 	//  Implements a Digital Controlled Oscillator (DCO)
@@ -21,8 +59,8 @@ namespace DadDSP {
 			m_sampleRate = sampleRate;
 			m_minFreq = minFreq;
 			m_maxFreq = maxFreq;
-			m_dcoValue = 0;
-			m_dcoStep = 0;
+			m_Phase = 0;
+			m_PhaseStep = 0;
 
 			setNormalizedFreq(frequency);
 			setNormalizedDutyCycle(dutyCycle);
@@ -32,15 +70,15 @@ namespace DadDSP {
 		// Sets the frequency between 0 and 1 (0 = minFreq, 1 = maxFreq)
 		inline void setNormalizedFreq(float frequency) {
 			// Converts normalized frequency to actual step size
-			m_dcoStep = ((m_minFreq + (m_maxFreq - m_minFreq) * frequency) / m_sampleRate);
+			setFreq(m_minFreq + (m_maxFreq - m_minFreq) * frequency);
 		}
 
 		// --------------------------------------------------------------------------
-		// Sets the frequency in Hz
+		// Sets the frequency in Hz (0 outside ]0, Nyquist[)
 		inline void setFreq(float frequency) {
-			m_dcoStep = frequency / m_sampleRate;
+			m_PhaseStep = ToStep(frequency, m_sampleRate);
 		}
-		
+
 		// --------------------------------------------------------------------------
 		// Sets the duty cycle of the DCO between 0 and 1
 		inline void setNormalizedDutyCycle(float dutyCycle) {
@@ -52,12 +90,9 @@ namespace DadDSP {
 
 
 		// --------------------------------------------------------------------------
-		// Advances the oscillator by one step (-1/sampleRate)
+		// Advances the oscillator by one step (1/sampleRate), the phase wraps
 		inline void Step() {
-			m_dcoValue += m_dcoStep;
-			if (m_dcoValue > 1.0f) {
-				m_dcoValue -= 1.0f;
-			}
+			m_Phase += m_PhaseStep;
 		}
 
 		// --------------------------------------------------------------------------
@@ -66,107 +101,136 @@ namespace DadDSP {
 			constexpr float riseTime = 0.04f;
 			constexpr float fallStart = 0.7f;
 			constexpr float fallEnd = fallStart + riseTime;
+			const float Position = getPosition();
 
 			// Generates a waveform with a defined rising and falling edge
-			if (m_dcoValue > fallEnd) {
+			if (Position > fallEnd) {
 				return 0;
-			} else if (m_dcoValue > fallStart) {
-				return 1 - ((m_dcoValue - fallStart) / riseTime);
-			} else if (m_dcoValue > riseTime) {
+			} else if (Position > fallStart) {
+				return 1 - ((Position - fallStart) / riseTime);
+			} else if (Position > riseTime) {
 				return 1;
 			} else {
-				return (m_dcoValue / riseTime);
+				return (Position / riseTime);
 			}
 		}
 
 		// --------------------------------------------------------------------------
 		// Reads the square wave output value with duty cycle variation
 		inline float getSquareModValue() {
-			constexpr float riseTime = 0.04f;
-
 			// Adjusts the waveform based on duty cycle
-			if (m_dcoValue > (m_dutyCycle + riseTime)) {
-				return 0;
-			} else if (m_dcoValue > m_dutyCycle) {
-				return 1 - ((m_dcoValue - m_dutyCycle) / riseTime);
-			} else if (m_dcoValue > riseTime) {
-				return 1;
-			} else {
-				return (m_dcoValue / riseTime);
-			}
+			return SquareMod(getPosition(), m_dutyCycle);
 		}
 
 		// --------------------------------------------------------------------------
 		// Reads the triangle wave output value
 		inline float getTriangleValue() {
-			// Creates a symmetrical triangle waveform
-			if (m_dcoValue > 0.5f) {
-				return 2 - (m_dcoValue * 2);
-			} else {
-				return (m_dcoValue * 2);
-			}
+			return Triangle(m_Phase);
 		}
 
 		// --------------------------------------------------------------------------
 		// Reads the phase-shifted triangle wave output value
+		// (phaseShift in periods, any sign)
 		inline float getTriangleValuePhased(float phaseShift) {
-		    // Apply phase shift and wrap to [0, 1)
-		    float t = fmod(m_dcoValue + phaseShift, 1.0f);
-		    if (t < 0.0f) t += 1.0f;
-
-		    // Creates a symmetrical triangle waveform
-		    if (t > 0.5f) {
-		        return 2.0f - (t * 2.0f);
-		    } else {
-		        return t * 2.0f;
-		    }
+			return Triangle(m_Phase + ToPhase(phaseShift));
 		}
 
 		// --------------------------------------------------------------------------
 		// Reads the triangle wave output value with duty cycle variation
 		inline float getTriangleModValue() {
 			// Adjusts the waveform based on duty cycle
-			if (m_dcoValue > m_dutyCycle) {
-				return (1 - m_dcoValue) / (1 - m_dutyCycle);
-			} else {
-				return (m_dcoValue / m_dutyCycle);
-			}
+			return TriangleMod(getPosition(), m_dutyCycle);
 		}
 
 		// --------------------------------------------------------------------------
-		// Reads the sine wave output value
+		// Reads the sine wave output value (raised cosine, 0 to 1)
 		inline float getSineValue() {
-			// Generates a sine wave from phase
-			return 0.5f + (sin((m_twoPI * m_dcoValue) + m_halfPI) / 2.0f);
+			return 0.5f + (Sine(m_Phase + kQuarterPeriod) * 0.5f);
 		}
 
 		// --------------------------------------------------------------------------
 		// Reads the rectified sine wave output value
 		inline float getRectifiedSineValue() {
-			// Uses absolute sine to create a half-wave rectified signal
-			return sin(m_PI * m_dcoValue);
+			// First half period of the sine over the whole period
+			return Sine(m_Phase >> 1);
 		}
 
 		// --------------------------------------------------------------------------
-		// Sets the oscillator position
+		// Sets the oscillator position (in periods)
 		inline void setPosition(float position) {
-			m_dcoValue = position;
+			m_Phase = ToPhase(position);
+		}
+
+		// --------------------------------------------------------------------------
+		// Oscillator position in [0, 1]
+		inline float getPosition() const {
+			return static_cast<float>(m_Phase) * (1.0f / kPeriod);
+		}
+
+		// --------------------------------------------------------------------------
+		// Phase helpers (shared with cDCOBank)
+		static constexpr float kPeriod = 4294967296.0f;		// 2^32: one period
+		static constexpr uint32_t kQuarterPeriod = 0x40000000u;
+
+		// Phase step of a frequency (0 outside ]0, Nyquist[)
+		static inline uint32_t ToStep(float frequency, float sampleRate) {
+			const float Ratio = frequency / sampleRate;
+			return ((Ratio > 0.0f) && (Ratio < 0.5f)) ? static_cast<uint32_t>((Ratio * kPeriod) + 0.5f) : 0;
+		}
+
+		// Phase of a position in periods
+		static inline uint32_t ToPhase(float Position) {
+			float Fraction = Position - truncf(Position);	// ]-1, 1[, exact
+			return static_cast<uint32_t>(static_cast<int32_t>(Fraction * 2147483648.0f)) << 1;
+		}
+
+		// Triangle 0 -> 1 -> 0 over a period
+		static inline float Triangle(uint32_t Phase) {
+			uint32_t Folded = (Phase & 0x80000000u) ? ~Phase : Phase;
+			return static_cast<float>(Folded) * (1.0f / 2147483648.0f);
+		}
+
+		// Sine of a phase, interpolated in the table
+		static inline float Sine(uint32_t Phase) {
+			constexpr uint32_t FracBits = 32 - DCO_SINE_BITS;
+			const uint32_t Index = Phase >> FracBits;
+			const float Frac = static_cast<float>(Phase & ((1u << FracBits) - 1)) * (1.0f / (1u << FracBits));
+			const float Value = __DCOSineTable.Value[Index];
+			return Value + ((__DCOSineTable.Value[Index + 1] - Value) * Frac);
 		}
 
+		// Square with rounded edges, high until dutyCycle
+		static inline float SquareMod(float Position, float dutyCycle) {
+			constexpr float riseTime = 0.04f;
+			if (Position > (dutyCycle + riseTime)) {
+				return 0;
+			} else if (Position > dutyCycle) {
+				return 1 - ((Position - dutyCycle) / riseTime);
+			} else if (Position > riseTime) {
+				return 1;
+			} else {
+				return (Position / riseTime);
+			}
+		}
+
+		// Triangle peaking at dutyCycle
+		static inline float TriangleMod(float Position, float dutyCycle) {
+			if (Position > dutyCycle) {
+				return (1 - Position) / (1 - dutyCycle);
+			} else {
+				return (Position / dutyCycle);
+			}
+		}
 
 	private:
 		// --------------------------------------------------------------------------
 		// Member variables
-		const float m_twoPI = 6.28318530717959F;
-		const float m_PI = 3.14159265358979F;
-		const float m_halfPI = 1.5707963267949F;
 		float m_sampleRate = 0.0f;
 		float m_minFreq = 0.0f;
 		float m_maxFreq = 0.0f;
 		float m_dutyCycle;
-		float m_dcoValue = 0.0f;
-		float m_dcoStep = 0.0f;
+		uint32_t m_Phase = 0;			// Phase accumulator
+		uint32_t m_PhaseStep = 0;		// Phase increment per step
 	};
 
 } // DadDSP
-
@@ -0,0 +1,152 @@
+#pragma once
+//====================================================================================
+// File: cDCOBank.h
+// Description:
+// Bank of N Digital Controlled Oscillators (stereo LFOs, chorus voices)
+//
+// The phases, steps and duty cycles are stored as arrays (structure of arrays):
+// Step() and every output are one loop over the N oscillators, without per
+// object calls, that the compiler can unroll or vectorize. The outputs are
+// those of cDCO (same phase helpers), oscillator by oscillator.
+//====================================================================================
+#include "cDCO.h"
+#include <cstddef>
+
+namespace DadDSP {
+
+	//***********************************************************************************
+	//  cDCOBank
+	//  N oscillators stepped and read together
+	//***********************************************************************************
+	template<size_t N>
+	class cDCOBank {
+
+	public:
+		static constexpr size_t kSize = N;
+
+		// --------------------------------------------------------------------------
+		// Initializes the N oscillators as cDCO::Initialize (same frequency, duty
+		// cycle, phase 0)
+		void Initialize(float sampleRate, float frequency, float minFreq, float maxFreq, float dutyCycle) {
+			m_sampleRate = sampleRate;
+			m_minFreq = minFreq;
+			m_maxFreq = maxFreq;
+			for (size_t Osc = 0; Osc < N; Osc++) {
+				m_Phase[Osc] = 0;
+			}
+			setNormalizedFreq(frequency);
+			setNormalizedDutyCycle(dutyCycle);
+		}
+
+		// --------------------------------------------------------------------------
+		// Sets the frequency of all the oscillators between 0 and 1
+		// (0 = minFreq, 1 = maxFreq)
+		inline void setNormalizedFreq(float frequency) {
+			setFreq(m_minFreq + (m_maxFreq - m_minFreq) * frequency);
+		}
+
+		// --------------------------------------------------------------------------
+		// Sets the frequency of all the oscillators in Hz
+		inline void setFreq(float frequency) {
+			const uint32_t Step = cDCO::ToStep(frequency, m_sampleRate);
+			for (size_t Osc = 0; Osc < N; Osc++) {
+				m_PhaseStep[Osc] = Step;
+			}
+		}
+
+		// --------------------------------------------------------------------------
+		// Sets the frequency of one oscillator in Hz (detuned voices)
+		inline void setFreq(size_t Osc, float frequency) {
+			m_PhaseStep[Osc] = cDCO::ToStep(frequency, m_sampleRate);
+		}
+
+		// --------------------------------------------------------------------------
+		// Sets the duty cycle of all the oscillators between 0 and 1
+		inline void setNormalizedDutyCycle(float dutyCycle) {
+			constexpr float minDuty = 0.1f;
+			constexpr float maxDuty = 0.9f;
+			const float Duty = minDuty + ((maxDuty - minDuty) * dutyCycle);
+			for (size_t Osc = 0; Osc < N; Osc++) {
+				m_dutyCycle[Osc] = Duty;
+			}
+		}
+
+		// --------------------------------------------------------------------------
+		// Sets the position of one oscillator (in periods)
+		inline void setPosition(size_t Osc, float position) {
+			m_Phase[Osc] = cDCO::ToPhase(position);
+		}
+
+		// --------------------------------------------------------------------------
+		// Spreads the oscillators over Spread periods from oscillator 0:
+		// oscillator i at i x Spread / N (Spread 1: evenly over the period)
+		inline void setSpread(float Spread) {
+			const uint32_t Offset = cDCO::ToPhase(Spread / static_cast<float>(N));
+			for (size_t Osc = 1; Osc < N; Osc++) {
+				m_Phase[Osc] = m_Phase[Osc - 1] + Offset;
+			}
+		}
+
+		// --------------------------------------------------------------------------
+		// Advances all the oscillators by one step
+		inline void Step() {
+			for (size_t Osc = 0; Osc < N; Osc++) {
+				m_Phase[Osc] += m_PhaseStep[Osc];
+			}
+		}
+
+		// --------------------------------------------------------------------------
+		// Advances all the oscillators and reads their sine output, in one loop
+		// (Step() then getSineValues())
+		inline void StepSineValues(float* pOut) {
+			for (size_t Osc = 0; Osc < N; Osc++) {
+				const uint32_t Phase = m_Phase[Osc] + m_PhaseStep[Osc];
+				m_Phase[Osc] = Phase;
+				pOut[Osc] = 0.5f + (cDCO::Sine(Phase + cDCO::kQuarterPeriod) * 0.5f);
+			}
+		}
+
+		// --------------------------------------------------------------------------
+		// Outputs of all the oscillators (pOut: N values), as the cDCO getters
+		inline void getTriangleValues(float* pOut) const {
+			for (size_t Osc = 0; Osc < N; Osc++) {
+				pOut[Osc] = cDCO::Triangle(m_Phase[Osc]);
+			}
+		}
+
+		inline void getSineValues(float* pOut) const {
+			for (size_t Osc = 0; Osc < N; Osc++) {
+				pOut[Osc] = 0.5f + (cDCO::Sine(m_Phase[Osc] + cDCO::kQuarterPeriod) * 0.5f);
+			}
+		}
+
+		inline void getTriangleModValues(float* pOut) const {
+			for (size_t Osc = 0; Osc < N; Osc++) {
+				pOut[Osc] = cDCO::TriangleMod(getPosition(Osc), m_dutyCycle[Osc]);
+			}
+		}
+
+		inline void getSquareModValues(float* pOut) const {
+			for (size_t Osc = 0; Osc < N; Osc++) {
+				pOut[Osc] = cDCO::SquareMod(getPosition(Osc), m_dutyCycle[Osc]);
+			}
+		}
+
+		// --------------------------------------------------------------------------
+		// Position of one oscillator in [0, 1]
+		inline float getPosition(size_t Osc) const {
+			return static_cast<float>(m_Phase[Osc]) * (1.0f / cDCO::kPeriod);
+		}
+
+	private:
+		// --------------------------------------------------------------------------
+		// Member variables
+		float m_sampleRate = 0.0f;
+		float m_minFreq = 0.0f;
+		float m_maxFreq = 0.0f;
+		uint32_t m_Phase[N] = {};		// Phase accumulators
+		uint32_t m_PhaseStep[N] = {};	// Phase increments per step
+		float m_dutyCycle[N] = {};
+	};
+
+} // DadDSP
@@ -0,0 +1,187 @@
+#pragma once
+//====================================================================================
+//
+// File: cDelayStorage.h
+// Description: Sample storage of the delay lines, policies of cBlockDelayLine.
+//
+//              A storage converts the float samples to the cells of the ring
+//              buffer and back:
+//                - cFloatStorage : 4 bytes per sample, exact
+//                - cInt16Storage : 2 bytes per sample, noise floor near -90 dBFS
+//                - cInt24Storage : 3 bytes per sample (packed), noise floor
+//                                  near -138 dBFS
+//              The integer storages keep 6 dB of headroom (full scale is +/-2.0)
+//              for the feedback loops, and saturate above it.
+//
+//              Halving the bytes per sample halves the SDRAM footprint and the
+//              bandwidth of every read: the same memory holds a longer delay
+//              (penda_bench -q gives the noise floor of each).
+//
+//              The converted storages are written through __DelayStage, a
+//              scratch in DTCM: the block is converted there, then copied to
+//              the SDRAM in 32 bit words (instead of byte or half word stores).
+//
+// Copyright (c) 2025 Dad Design.
+//
+//====================================================================================
+#include "main.h"
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+
+namespace DadDSP {
+
+// Longest span a block delay line stages (a block whose delays move by one
+// sample per frame, with the 4-point neighbourhood)
+constexpr size_t DELAY_STAGE_SPAN = (2 * AUDIO_BUFFER_SIZE_MAX) + 4;
+
+// --------------------------------------------------------------------------
+// Copies Bytes bytes in 32 bit words (unaligned accesses are allowed on the
+// Cortex-M7 normal memory), then the remaining bytes
+inline void CopyBytes(void* pDest, const void* pSource, size_t Bytes) {
+    uint8_t* pTo = static_cast<uint8_t*>(pDest);
+    const uint8_t* pFrom = static_cast<const uint8_t*>(pSource);
+    size_t Index = 0;
+    for (; (Index + 4) <= Bytes; Index += 4) {
+        uint32_t Word;
+        memcpy(&Word, &pFrom[Index], sizeof(Word));
+        memcpy(&pTo[Index], &Word, sizeof(Word));
+    }
+    for (; Index < Bytes; Index++) {
+        pTo[Index] = pFrom[Index];
+    }
+}
+
+//***********************************************************************************
+// class cFloatStorage
+//***********************************************************************************
+class cFloatStorage
+{
+public:
+    using tCell = float;
+    static constexpr uint32_t kCellsPerSample = 1;
+    static constexpr bool kDirectWrite = true;      // Nothing to convert: written in place
+
+    // --------------------------------------------------------------------------
+    // Cells to allocate for Capacity samples
+    static constexpr size_t getCells(uint32_t Capacity) { return Capacity; }
+
+    // --------------------------------------------------------------------------
+    // Sample Index
+    static inline float Load(const tCell* pBuffer, uint32_t Index) { return pBuffer[Index]; }
+    static inline void Store(tCell* pBuffer, uint32_t Index, float Sample) { pBuffer[Index] = Sample; }
+
+    // --------------------------------------------------------------------------
+    // Copies Count cells (staged writes)
+    static inline void CopyCells(tCell* pDest, const tCell* pSource, size_t Count) {
+        CopyBytes(pDest, pSource, Count * sizeof(tCell));
+    }
+};
+
+//***********************************************************************************
+// class cInt16Storage
+//***********************************************************************************
+class cInt16Storage
+{
+public:
+    using tCell = int16_t;
+    static constexpr uint32_t kCellsPerSample = 1;
+    static constexpr bool kDirectWrite = false;     // Written through __DelayStage
+
+    // --------------------------------------------------------------------------
+    // Cells to allocate for Capacity samples
+    static constexpr size_t getCells(uint32_t Capacity) { return Capacity; }
+
+    // --------------------------------------------------------------------------
+    // Sample Index
+    static inline float Load(const tCell* pBuffer, uint32_t Index) {
+        return static_cast<float>(pBuffer[Index]) * kToFloat;
+    }
+
+    static inline void Store(tCell* pBuffer, uint32_t Index, float Sample) {
+        float Scaled = Sample * kToInt;
+        Scaled = (Scaled > 32767.0f) ? 32767.0f : ((Scaled < -32768.0f) ? -32768.0f : Scaled);
+        pBuffer[Index] = static_cast<tCell>(Scaled + ((Scaled < 0.0f) ? -0.5f : 0.5f));
+    }
+
+    // --------------------------------------------------------------------------
+    // Copies Count cells (staged writes)
+    static inline void CopyCells(tCell* pDest, const tCell* pSource, size_t Count) {
+        CopyBytes(pDest, pSource, Count * sizeof(tCell));
+    }
+
+private:
+    static constexpr float kToInt = 16384.0f;           // Full scale +/-2.0
+    static constexpr float kToFloat = 1.0f / 16384.0f;
+};
+
+//***********************************************************************************
+// class cInt24Storage
+// Packed: sample i in bytes 3i..3i+2 (little endian). One padding byte after
+// the last sample lets a sample be read with a single unaligned 32 bit load.
+//***********************************************************************************
+class cInt24Storage
+{
+public:
+    using tCell = uint8_t;
+    static constexpr uint32_t kCellsPerSample = 3;
+    static constexpr bool kDirectWrite = false;     // Written through __DelayStage
+
+    // --------------------------------------------------------------------------
+    // Cells to allocate for Capacity samples
+    static constexpr size_t getCells(uint32_t Capacity) { return (3 * static_cast<size_t>(Capacity)) + 1; }
+
+    // --------------------------------------------------------------------------
+    // Sample Index
+    static inline float Load(const tCell* pBuffer, uint32_t Index) {
+        uint32_t Word;
+        memcpy(&Word, &pBuffer[3 * Index], sizeof(Word));   // Unaligned load
+        return static_cast<float>(static_cast<int32_t>(Word << 8) >> 8) * kToFloat;
+    }
+
+    static inline void Store(tCell* pBuffer, uint32_t Index, float Sample) {
+        float Scaled = Sample * kToInt;
+        Scaled = (Scaled > 8388607.0f) ? 8388607.0f : ((Scaled < -8388608.0f) ? -8388608.0f : Scaled);
+        int32_t Value = static_cast<int32_t>(Scaled + ((Scaled < 0.0f) ? -0.5f : 0.5f));
+        tCell* pCell = &pBuffer[3 * Index];
+        pCell[0] = static_cast<tCell>(Value);
+        pCell[1] = static_cast<tCell>(Value >> 8);
+        pCell[2] = static_cast<tCell>(Value >> 16);
+    }
+
+    // --------------------------------------------------------------------------
+    // Copies Count cells (staged writes)
+    static inline void CopyCells(tCell* pDest, const tCell* pSource, size_t Count) {
+        CopyBytes(pDest, pSource, Count);
+    }
+
+private:
+    static constexpr float kToInt = 4194304.0f;         // Full scale +/-2.0
+    static constexpr float kToFloat = 1.0f / 4194304.0f;
+};
+
+//***********************************************************************************
+// struct sStorageReader
+// Samples of a ring buffer seen as an array of floats (interpolator source)
+//***********************************************************************************
+template<typename tStorage>
+struct sStorageReader {
+    const typename tStorage::tCell* pBuffer;
+
+    inline float operator[](uint32_t Index) const { return tStorage::Load(pBuffer, Index); }
+};
+
+//***********************************************************************************
+// struct sDelayStage
+// DTCM scratch shared by the block delay lines (the effects run one after the
+// other: a line only uses it during one of its calls)
+//***********************************************************************************
+struct sDelayStage {
+    float   Samples[DELAY_STAGE_SPAN];                      // Span read by a block / tap mix
+    alignas(4) uint8_t Cells[(4 * AUDIO_BUFFER_SIZE_MAX) + 4];  // Converted block to write
+};
+
+} // DadDSP
+
+extern DTCM_SECTION DadDSP::sDelayStage __DelayStage;
@@ -0,0 +1,142 @@
+#pragma once
+//====================================================================================
+//
+// File: cInterpolator.h
+// Description: Fractional delay interpolators, policies of cBlockDelayLine.
+//
+//              Interpolate() reads a ring buffer around Index, the sample at the
+//              integer part of the delay, and returns the sample Frac (0..1)
+//              further in the past. kMinDelay is the smallest delay the
+//              interpolator accepts: the 4-point and allpass interpolators read
+//              one sample newer than Index.
+//
+//              The source is any array of floats: a float pointer or the
+//              sStorageReader of an integer storage (cDelayStorage.h).
+//
+//              Cost / quality (penda_bench -q):
+//                - cLinearInterpolator   : 2 samples, low pass at half sample
+//                                          delays (-3 dB near 12 kHz at 48 kHz)
+//                - cHermiteInterpolator  : 4 samples, 3rd order Hermite
+//                - cLagrangeInterpolator : 4 samples, 3rd order Lagrange
+//                - cAllpassInterpolator  : 2 samples and a division, flat
+//                                          magnitude, one state per line: for
+//                                          slowly modulated delays only
+//
+// Copyright (c) 2025 Dad Design.
+//
+//====================================================================================
+#include <cstdint>
+
+
+namespace DadDSP {
+
+//***********************************************************************************
+// class cLinearInterpolator
+//***********************************************************************************
+class cLinearInterpolator
+{
+public:
+    static constexpr uint32_t kMinDelay = 0;
+
+    // --------------------------------------------------------------------------
+    // Clears the interpolator state (none)
+    inline void Clear() {}
+
+    // --------------------------------------------------------------------------
+    // Sample Frac older than Buffer[Index]
+    template<typename tSource>
+    inline float Interpolate(const tSource& Buffer, uint32_t Mask, uint32_t Index, float Frac) {
+        float Newer = Buffer[Index];
+        float Older = Buffer[(Index - 1) & Mask];
+        return Newer + ((Older - Newer) * Frac);
+    }
+};
+
+//***********************************************************************************
+// class cHermiteInterpolator
+// 4-point, 3rd order Hermite (x-form)
+//***********************************************************************************
+class cHermiteInterpolator
+{
+public:
+    static constexpr uint32_t kMinDelay = 1;
+
+    // --------------------------------------------------------------------------
+    // Clears the interpolator state (none)
+    inline void Clear() {}
+
+    // --------------------------------------------------------------------------
+    // Sample Frac older than Buffer[Index]
+    template<typename tSource>
+    inline float Interpolate(const tSource& Buffer, uint32_t Mask, uint32_t Index, float Frac) {
+        float xm1 = Buffer[(Index + 1) & Mask];
+        float x0  = Buffer[Index];
+        float x1  = Buffer[(Index - 1) & Mask];
+        float x2  = Buffer[(Index - 2) & Mask];
+
+        float c1 = 0.5f * (x1 - xm1);
+        float c2 = xm1 - (2.5f * x0) + (2.0f * x1) - (0.5f * x2);
+        float c3 = (0.5f * (x2 - xm1)) + (1.5f * (x0 - x1));
+        return (((((c3 * Frac) + c2) * Frac) + c1) * Frac) + x0;
+    }
+};
+
+//***********************************************************************************
+// class cLagrangeInterpolator
+// 4-point, 3rd order Lagrange
+//***********************************************************************************
+class cLagrangeInterpolator
+{
+public:
+    static constexpr uint32_t kMinDelay = 1;
+
+    // --------------------------------------------------------------------------
+    // Clears the interpolator state (none)
+    inline void Clear() {}
+
+    // --------------------------------------------------------------------------
+    // Sample Frac older than Buffer[Index]
+    template<typename tSource>
+    inline float Interpolate(const tSource& Buffer, uint32_t Mask, uint32_t Index, float Frac) {
+        float xm1 = Buffer[(Index + 1) & Mask];
+        float x0  = Buffer[Index];
+        float x1  = Buffer[(Index - 1) & Mask];
+        float x2  = Buffer[(Index - 2) & Mask];
+
+        float c1 = x1 - (x0 * 0.5f) - (xm1 * (1.0f / 3.0f)) - (x2 * (1.0f / 6.0f));
+        float c2 = (0.5f * (xm1 + x1)) - x0;
+        float c3 = ((x2 - xm1) * (1.0f / 6.0f)) + (0.5f * (x0 - x1));
+        return (((((c3 * Frac) + c2) * Frac) + c1) * Frac) + x0;
+    }
+};
+
+//***********************************************************************************
+// class cAllpassInterpolator
+// First order allpass, fractional delay 1 + Frac from the newer sample: the
+// coefficient stays in ]-1/3, 0] (no ringing near integer delays).
+//***********************************************************************************
+class cAllpassInterpolator
+{
+public:
+    static constexpr uint32_t kMinDelay = 1;
+
+    // --------------------------------------------------------------------------
+    // Clears the interpolator state
+    inline void Clear() { m_Previous = 0.0f; }
+
+    // --------------------------------------------------------------------------
+    // Sample Frac older than Buffer[Index]
+    template<typename tSource>
+    inline float Interpolate(const tSource& Buffer, uint32_t Mask, uint32_t Index, float Frac) {
+        float Newer = Buffer[(Index + 1) & Mask];
+        float x0    = Buffer[Index];
+        float Coef  = -Frac / (2.0f + Frac);
+        m_Previous  = x0 + (Coef * (Newer - m_Previous));
+        return m_Previous;
+    }
+
+private:
+    float m_Previous = 0.0f;    // Last output
+};
+
+} // DadDSP
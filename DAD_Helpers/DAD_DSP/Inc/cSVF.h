@@ -0,0 +1,167 @@
+#pragma once
+//====================================================================================
+//
+// File: cSVF.h
+// Description: State variable filter, topology preserving transform (TPT / zero
+//              delay feedback) of the analog SVF.
+//
+//              One structure gives the low pass, band pass, high pass and notch
+//              outputs. The response matches the bilinear biquads of cBiQuad, but
+//              the coefficients come from a single tan() of the cutoff and the
+//              state stays valid when they change on every sample: the cutoff can
+//              be modulated at audio rate (envelope filter, auto-wah, LFO sweeps).
+//
+// Usage:
+//   - Call `Initialize()` with the sample rate, cutoff, Q and output.
+//   - Per sample: `setCutoffFreq()` then `Process(sample, channel)`.
+//   - Per block : `Process(In, Out)`, or `Process(In, Out, pCutoff)` with one
+//                 cutoff per frame.
+//
+// Copyright (c) 2025 Dad Design.
+//
+//====================================================================================
+#include "main.h"
+#include "AudioBlock.h"
+#include "BiquadFilter.h"
+#include <cstdint>
+
+namespace DadDSP {
+
+enum class eSVFOutput : int {
+	LowPass = 0,
+	BandPass,
+	HighPass,
+	Notch
+};
+
+// All the outputs of one sample
+struct sSVFOutputs{
+	float LowPass;
+	float BandPass;
+	float HighPass;
+	float Notch;
+};
+
+// Integrator states of one channel
+struct sSVFState{
+	float ic1eq;
+	float ic2eq;
+};
+
+//***********************************************************************************
+// class cSVF
+//***********************************************************************************
+class cSVF {
+public:
+    // ==========================================================================
+    // Filter configuration
+    void Initialize(float sampleRate, float cutoffFreq, float Q, eSVFOutput output);
+
+    // ==========================================================================
+    // Set filter parameters (cheap: one tan approximation and one division)
+    inline void setCutoffFreq(float cutoffFreq) {
+    	m_cutoffFreq = cutoffFreq;
+    	m_g = Tan(cutoffFreq);
+    	UpdateCoefficients();
+    }
+    inline void setQ(float Q) {
+    	m_Q = Q;
+    	m_k = 1.0f / Q;
+    	UpdateCoefficients();
+    }
+    inline void setOutput(eSVFOutput output) { m_output = output; }
+
+    // ==========================================================================
+    // Get filter parameters
+    inline float getSampleRate() { return m_sampleRate; }
+    inline float getCutoffFreq() { return m_cutoffFreq; }
+    inline float getQ() { return m_Q; }
+    inline eSVFOutput getOutput() { return m_output; }
+
+    // Prewarped integrator gain g = tan(pi * Freq / SampleRate)
+    inline float getPrewarpedGain(float Freq) const { return Tan(Freq); }
+
+    // ==========================================================================
+    // Clears the filter states
+    void Clear();
+
+    // ==========================================================================
+    // Process one sample, all outputs
+    inline sSVFOutputs ProcessAll(float sample, eChannel Channel) {
+    	sSVFState &State = m_State[static_cast<int>(Channel)];
+    	float v1, v2;
+    	Tick(sample, State, m_a1, m_a2, m_a3, v1, v2);
+    	float Notch = sample - (m_k * v1);
+    	return sSVFOutputs{v2, v1, Notch - v2, Notch};
+    }
+
+    // ==========================================================================
+    // Process one sample, selected output
+    inline float Process(float sample, eChannel Channel) {
+    	sSVFOutputs Outputs = ProcessAll(sample, Channel);
+    	switch (m_output) {
+    	case eSVFOutput::LowPass :	return Outputs.LowPass;
+    	case eSVFOutput::BandPass :	return Outputs.BandPass;
+    	case eSVFOutput::HighPass :	return Outputs.HighPass;
+    	default :					return Outputs.Notch;
+    	}
+    }
+
+    // ==========================================================================
+    // Process a stereo block, selected output (In and Out may be the same block)
+    ITCM void Process(const AudioBlock &In, const AudioBlock &Out);
+
+    // ==========================================================================
+    // Same, with the cutoff of every frame in pCutoff (Hz, In.Size values).
+    // The last one stays the cutoff of the filter.
+    ITCM void Process(const AudioBlock &In, const AudioBlock &Out, const float *pCutoff);
+
+protected:
+    // ==========================================================================
+    // tan(pi * Freq / SampleRate), continued fraction (relative error below
+    // 1e-6 up to 0.49 x SampleRate, where the cutoff is clamped)
+    inline float Tan(float Freq) const {
+    	float x = m_piOverSampleRate * ((Freq < m_maxFreq) ? Freq : m_maxFreq);
+    	float x2 = x * x;
+    	return x * (135135.0f + x2 * (-17325.0f + x2 * (378.0f - x2)))
+    	         / (135135.0f + x2 * (-62370.0f + x2 * (3150.0f - 28.0f * x2)));
+    }
+
+    // ==========================================================================
+    // Coefficients from g and k
+    inline void UpdateCoefficients() {
+    	m_a1 = 1.0f / (1.0f + m_g * (m_g + m_k));
+    	m_a2 = m_g * m_a1;
+    	m_a3 = m_g * m_a2;
+    }
+
+    // ==========================================================================
+    // One step of the structure: v1 band pass, v2 low pass
+    static inline void Tick(float x, sSVFState &State, float a1, float a2, float a3, float &v1, float &v2) {
+    	float v3 = x - State.ic2eq;
+    	v1 = (a1 * State.ic1eq) + (a2 * v3);
+    	v2 = State.ic2eq + (a2 * State.ic1eq) + (a3 * v3);
+    	State.ic1eq = (2.0f * v1) - State.ic1eq;
+    	State.ic2eq = (2.0f * v2) - State.ic2eq;
+    }
+
+    // Filter parameters
+    float m_sampleRate = 48000.0f;
+    float m_cutoffFreq = 1000.0f;
+    float m_Q = 0.707f;
+    eSVFOutput m_output = eSVFOutput::LowPass;
+    float m_piOverSampleRate = 0;
+    float m_maxFreq = 0;
+
+    // Coefficients
+    float m_g = 0;		// Prewarped integrator gain
+    float m_k = 0;		// Damping (1 / Q)
+    float m_a1 = 0;
+    float m_a2 = 0;
+    float m_a3 = 0;
+
+    // States (Left, Right)
+    sSVFState m_State[2] = {};
+};
+
+} // namespace DadDSP
@@ -6,6 +6,7 @@
 /* by Robert Bristow-Johnson  <rbj@audioimagination.com>                   */
 /***************************************************************************/
 #include "BiquadFilter.h"
+#include "FastMath.h"
 
 namespace DadDSP {
 
@@ -22,16 +23,16 @@ void cBiQuad::Initialize(float sampleRate, float cutoffFreq, float gainDb, float
 }
 
 // ==========================================================================
-// Calculate filter parameters
-void cBiQuad::CalculateParameters() {
+// Coefficients of the current parameters
+void cBiQuad::ComputeCoefficients(sBiQuadCoefs &Coefs) const {
 	float a0, a1, a2, b0, b1, b2; // Coefficients
 
 	// Calculate intermediate variables
-	float A = std::pow(10, m_gainDb / 40); // Gain in linear scale
+	float A = DbToLinear(m_gainDb / 2); // Gain in linear scale (10^(gainDb/40))
 	float omega = 2 * kPi * m_cutoffFreq / m_sampleRate; // Angular frequency
-	float sn = std::sin(omega); // Sine of omega
-	float cs = std::cos(omega); // Cosine of omega
-	float alpha = sn * std::sinh(kNaturalLog2 / 2 * m_bandwidth * omega / sn); // Bandwidth parameter
+	float sn, cs; // Sine and cosine of omega
+	FastSinCos(omega, sn, cs);
+	float alpha = sn * FastSinh(kNaturalLog2 / 2 * m_bandwidth * omega / sn); // Bandwidth parameter
 	float beta = std::sqrt(A + A); // Intermediate variable for shelving filters
 
 	// Calculate coefficients based on filter type
@@ -98,29 +99,96 @@ void cBiQuad::CalculateParameters() {
 
 	}
 
-	// Precompute coefficients
-    __disable_irq();
-	m_a0 = b0 / a0;
-	m_a1 = b1 / a0;
-	m_a2 = b2 / a0;
-	m_a3 = a1 / a0;
-	m_a4 = a2 / a0;
-    __enable_irq();
+	// Normalize coefficients
+	Coefs.a0 = b0 / a0;
+	Coefs.a1 = b1 / a0;
+	Coefs.a2 = b2 / a0;
+	Coefs.a3 = a1 / a0;
+	Coefs.a4 = a2 / a0;
+}
+
+// ==========================================================================
+// Calculate filter parameters
+void cBiQuad::CalculateParameters() {
+	sBiQuadCoefs Coefs;
+	ComputeCoefficients(Coefs);
+
+	// No interrupt masking: the coefficients are only written by the audio
+	// context (parameter callbacks run from cPendaUI::RTProcess, before
+	// Process) or before the filter is processed (Initialize), as with the
+	// control rate path
+	m_a0 = Coefs.a0;
+	m_a1 = Coefs.a1;
+	m_a2 = Coefs.a2;
+	m_a3 = Coefs.a3;
+	m_a4 = Coefs.a4;
+	m_Cascade = (m_type == FilterType::LPF24) || (m_type == FilterType::HPF24);
+	m_UpdatePending = false;
+	m_RampFrames = 0;
+}
+
+// ==========================================================================
+// Control rate coefficient updates
+void cBiQuad::setControlRate(float RateHz) {
+	m_ControlPeriod = (RateHz > 0) ? static_cast<uint32_t>(m_sampleRate / RateHz) : 0;
+	if (m_ControlPeriod == 0) {
+		CalculateParameters();			// Ends a pending update or ramp
+	}
+}
+
+// ==========================================================================
+// Control rate: next interpolation step
+void cBiQuad::StepCoefficients(size_t nFrames) {
+	if (m_RampFrames == 0) {
+		if (!m_UpdatePending) {
+			return;
+		}
+		// At most one calculation per control period
+		m_UpdatePending = false;
+		ComputeCoefficients(m_TargetCoefs);
+		m_Cascade = (m_type == FilterType::LPF24) || (m_type == FilterType::HPF24);
+		m_RampFrames = m_ControlPeriod;
+	}
+
+	if (nFrames >= m_RampFrames) {
+		m_a0 = m_TargetCoefs.a0;
+		m_a1 = m_TargetCoefs.a1;
+		m_a2 = m_TargetCoefs.a2;
+		m_a3 = m_TargetCoefs.a3;
+		m_a4 = m_TargetCoefs.a4;
+		m_RampFrames = 0;
+	} else {
+		// Remaining distance over remaining time: a straight line to the target
+		float Fraction = static_cast<float>(nFrames) / m_RampFrames;
+		m_a0 += (m_TargetCoefs.a0 - m_a0) * Fraction;
+		m_a1 += (m_TargetCoefs.a1 - m_a1) * Fraction;
+		m_a2 += (m_TargetCoefs.a2 - m_a2) * Fraction;
+		m_a3 += (m_TargetCoefs.a3 - m_a3) * Fraction;
+		m_a4 += (m_TargetCoefs.a4 - m_a4) * Fraction;
+		m_RampFrames -= nFrames;
+	}
 }
 
 // ==========================================================================
 // Calculate gain for a given frequency
 float cBiQuad::GainDb(float freq) {
-	float Phi = 4 * std::sin(std::pow(kPi * freq / m_sampleRate, 2.0));
+	float Sin = std::sin(kPi * freq / m_sampleRate);
+	sBiQuadCoefs Coefs = {m_a0, m_a1, m_a2, m_a3, m_a4};
+	float Gain = 10 * std::log10(MagnitudeSquared(Coefs, 4 * Sin * Sin));
 
-	float num = ((m_a0 * m_a2 * (Phi * Phi)) + std::pow(m_a0 + m_a1 + m_a2, 2.0) - (((m_a0 * m_a1) + (4 * m_a0 * m_a2) + (m_a1 * m_a2)) * Phi));
-	float denum = (m_a4 * std::pow(Phi, 2.0)) + std::pow(m_a3 + m_a4 + 1, 2.0) - (((m_a3 * m_a4) + m_a3 + (4 * +m_a4)) * Phi);
+	return m_Cascade ? (2 * Gain) : Gain;
+}
 
-	if ((m_type == FilterType::LPF24) || (m_type == FilterType::HPF24)) {
-		return (20 * std::log10(std::sqrt(num / denum))) + (20 * log10(std::sqrt(num / denum)));
-	}
-	else {
-		return 20 * std::log10(std::sqrt(num / denum));
+// ==========================================================================
+// Gains of Count frequencies
+void cBiQuad::GainDb(const float *pFreq, float *pGainDb, size_t Count) const {
+	sBiQuadCoefs Coefs;
+	ComputeCoefficients(Coefs);
+	const float Scale = ((m_type == FilterType::LPF24) || (m_type == FilterType::HPF24)) ? 20.0f : 10.0f;
+	const float PiOverSampleRate = kPi / m_sampleRate;
+	for (size_t Index = 0; Index < Count; Index++) {
+		float Sin = std::sin(PiOverSampleRate * pFreq[Index]);
+		pGainDb[Index] = Scale * std::log10(MagnitudeSquared(Coefs, 4 * Sin * Sin));
 	}
 }
 
@@ -147,4 +215,186 @@ float cBiQuad::Process(float sample, sFilterState &FilterState) {
 	return result;
 }
 
+// ==========================================================================
+// Stereo block kernel (Stages: 1, or 2 for the 24 dB types)
+template<int Stages>
+ITCM static inline void ProcessTDF2(float b0, float b1, float b2, float a1, float a2,
+                                    sTDF2State *pState, const AudioBlock &In, const AudioBlock &Out) {
+	// State in registers for the whole block
+	float s1L[Stages], s2L[Stages], s1R[Stages], s2R[Stages];
+	for (int Stage = 0; Stage < Stages; Stage++) {
+		s1L[Stage] = pState[Stage].s1L;
+		s2L[Stage] = pState[Stage].s2L;
+		s1R[Stage] = pState[Stage].s1R;
+		s2R[Stage] = pState[Stage].s2R;
+	}
+
+	const float *pInL = In.Left;
+	const float *pInR = In.Right;
+	float *pOutL = Out.Left;
+	float *pOutR = Out.Right;
+	for (size_t Index = 0; Index < In.Size; Index++) {
+		float xL = *pInL;
+		float xR = *pInR;
+		for (int Stage = 0; Stage < Stages; Stage++) {
+			float yL = (b0 * xL) + s1L[Stage];
+			float yR = (b0 * xR) + s1R[Stage];
+			s1L[Stage] = (b1 * xL) - (a1 * yL) + s2L[Stage];
+			s1R[Stage] = (b1 * xR) - (a1 * yR) + s2R[Stage];
+			s2L[Stage] = (b2 * xL) - (a2 * yL);
+			s2R[Stage] = (b2 * xR) - (a2 * yR);
+			xL = yL;
+			xR = yR;
+		}
+		*pOutL = xL;
+		*pOutR = xR;
+		pInL += In.Stride;
+		pInR += In.Stride;
+		pOutL += Out.Stride;
+		pOutR += Out.Stride;
+	}
+
+	for (int Stage = 0; Stage < Stages; Stage++) {
+		pState[Stage].s1L = s1L[Stage];
+		pState[Stage].s2L = s2L[Stage];
+		pState[Stage].s1R = s1R[Stage];
+		pState[Stage].s2R = s2R[Stage];
+	}
+}
+
+// ==========================================================================
+// process a stereo block
+void cBiQuad::Process(const AudioBlock &In, const AudioBlock &Out) {
+	if (m_ControlPeriod != 0) {
+		StepCoefficients(In.Size);
+	}
+	if (m_Cascade) {
+		ProcessTDF2<2>(m_a0, m_a1, m_a2, m_a3, m_a4, m_BlockState, In, Out);
+	} else {
+		ProcessTDF2<1>(m_a0, m_a1, m_a2, m_a3, m_a4, m_BlockState, In, Out);
+	}
+}
+
+// ==========================================================================
+// Cascade
+// ==========================================================================
+
+// ==========================================================================
+// Empty cascade
+void cBiQuadCascade::Initialize(float sampleRate) {
+	m_sampleRate = sampleRate;
+	m_NbSections = 0;
+}
+
+// ==========================================================================
+// Adds a section
+cBiQuad *cBiQuadCascade::addSection(float cutoffFreq, float gainDb, float bandwidth, FilterType type) {
+	if (m_NbSections >= BIQUAD_CASCADE_MAX) {
+		return nullptr;
+	}
+	cBiQuad *pSection = &m_Sections[m_NbSections++];
+	pSection->Initialize(m_sampleRate, cutoffFreq, gainDb, bandwidth, type);
+	return pSection;
+}
+
+// ==========================================================================
+// Control rate of all the sections
+void cBiQuadCascade::setControlRate(float RateHz) {
+	for (uint8_t Section = 0; Section < m_NbSections; Section++) {
+		m_Sections[Section].setControlRate(RateHz);
+	}
+}
+
+// ==========================================================================
+// Clears the filter states
+void cBiQuadCascade::Clear() {
+	for (uint8_t Section = 0; Section < m_NbSections; Section++) {
+		m_Sections[Section].m_BlockState[0] = sTDF2State{};
+		m_Sections[Section].m_BlockState[1] = sTDF2State{};
+	}
+}
+
+// ==========================================================================
+// Process a stereo block: every stage on each frame, so the block is read and
+// written once and the states are loaded and saved once per block
+void cBiQuadCascade::Process(const AudioBlock &In, const AudioBlock &Out) {
+	// Stages of the block: current coefficients (after the control rate
+	// step) and states, the 24 dB types giving two stages
+	struct sStage {
+		float b0, b1, b2, a1, a2;
+		float s1L, s2L, s1R, s2R;
+	};
+	sStage Stages[2 * BIQUAD_CASCADE_MAX];
+	sTDF2State *pStates[2 * BIQUAD_CASCADE_MAX];
+	int nStages = 0;
+	for (uint8_t Index = 0; Index < m_NbSections; Index++) {
+		cBiQuad &Section = m_Sections[Index];
+		if (Section.m_ControlPeriod != 0) {
+			Section.StepCoefficients(In.Size);
+		}
+		for (int Stage = 0; Stage < (Section.m_Cascade ? 2 : 1); Stage++) {
+			const sTDF2State &State = Section.m_BlockState[Stage];
+			Stages[nStages] = sStage{Section.m_a0, Section.m_a1, Section.m_a2, Section.m_a3, Section.m_a4,
+			                         State.s1L, State.s2L, State.s1R, State.s2R};
+			pStates[nStages] = &Section.m_BlockState[Stage];
+			nStages++;
+		}
+	}
+
+	const float *pInL = In.Left;
+	const float *pInR = In.Right;
+	float *pOutL = Out.Left;
+	float *pOutR = Out.Right;
+	for (size_t Index = 0; Index < In.Size; Index++) {
+		float xL = *pInL;
+		float xR = *pInR;
+		for (int Stage = 0; Stage < nStages; Stage++) {
+			sStage &S = Stages[Stage];
+			float yL = (S.b0 * xL) + S.s1L;
+			float yR = (S.b0 * xR) + S.s1R;
+			S.s1L = ((S.b1 * xL) + S.s2L) - (S.a1 * yL);
+			S.s1R = ((S.b1 * xR) + S.s2R) - (S.a1 * yR);
+			S.s2L = (S.b2 * xL) - (S.a2 * yL);
+			S.s2R = (S.b2 * xR) - (S.a2 * yR);
+			xL = yL;
+			xR = yR;
+		}
+		*pOutL = xL;
+		*pOutR = xR;
+		pInL += In.Stride;
+		pInR += In.Stride;
+		pOutL += Out.Stride;
+		pOutR += Out.Stride;
+	}
+
+	for (int Stage = 0; Stage < nStages; Stage++) {
+		pStates[Stage]->s1L = Stages[Stage].s1L;
+		pStates[Stage]->s2L = Stages[Stage].s2L;
+		pStates[Stage]->s1R = Stages[Stage].s1R;
+		pStates[Stage]->s2R = Stages[Stage].s2R;
+	}
+}
+
+// ==========================================================================
+// Gains of the whole cascade at Count frequencies
+void cBiQuadCascade::GainDb(const float *pFreq, float *pGainDb, size_t Count) const {
+	sBiQuadCoefs Coefs[BIQUAD_CASCADE_MAX];
+	for (uint8_t Section = 0; Section < m_NbSections; Section++) {
+		m_Sections[Section].ComputeCoefficients(Coefs[Section]);
+	}
+
+	// Product of the squared magnitudes, one log per frequency
+	const float PiOverSampleRate = kPi / m_sampleRate;
+	for (size_t Index = 0; Index < Count; Index++) {
+		float Sin = std::sin(PiOverSampleRate * pFreq[Index]);
+		float Phi = 4 * Sin * Sin;
+		float Magnitude2 = 1.0f;
+		for (uint8_t Section = 0; Section < m_NbSections; Section++) {
+			float SectionMagnitude2 = cBiQuad::MagnitudeSquared(Coefs[Section], Phi);
+			Magnitude2 *= m_Sections[Section].m_Cascade ? SectionMagnitude2 * SectionMagnitude2 : SectionMagnitude2;
+		}
+		pGainDb[Index] = 10 * std::log10(Magnitude2 + 1e-12f);
+	}
+}
+
 } // namespace DadDSP
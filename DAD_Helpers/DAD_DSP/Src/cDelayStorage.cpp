@@ -0,0 +1,12 @@
+//====================================================================================
+//
+// File: cDelayStorage.cpp
+// Description: DTCM staging scratch of the block delay lines.
+//
+// Copyright (c) 2025 Dad Design.
+//
+//====================================================================================
+#include "cDelayStorage.h"
+
+// Block delay lines stage their SDRAM spans here
+DTCM_SECTION DadDSP::sDelayStage __DelayStage;
@@ -0,0 +1,150 @@
+//====================================================================================
+//
+// File: cSVF.cpp
+// Description: State variable filter, topology preserving transform
+//
+// Copyright (c) 2025 Dad Design.
+//
+//====================================================================================
+#include "cSVF.h"
+
+namespace DadDSP {
+
+// ==========================================================================
+// Filter configuration
+void cSVF::Initialize(float sampleRate, float cutoffFreq, float Q, eSVFOutput output) {
+	m_sampleRate = sampleRate;
+	m_piOverSampleRate = kPi / sampleRate;
+	m_maxFreq = 0.49f * sampleRate;
+	m_output = output;
+	m_Q = Q;
+	m_k = 1.0f / Q;
+	setCutoffFreq(cutoffFreq);
+	Clear();
+}
+
+// ==========================================================================
+// Clears the filter states
+void cSVF::Clear() {
+	m_State[0] = sSVFState{0.0f, 0.0f};
+	m_State[1] = sSVFState{0.0f, 0.0f};
+}
+
+// ==========================================================================
+// Selected output from the band pass (v1) and low pass (v2) values
+template<eSVFOutput Output>
+static inline float SelectOutput(float x, float k, float v1, float v2) {
+	switch (Output) {
+	case eSVFOutput::LowPass :	return v2;
+	case eSVFOutput::BandPass :	return v1;
+	case eSVFOutput::HighPass :	return x - (k * v1) - v2;
+	default :					return x - (k * v1);
+	}
+}
+
+// ==========================================================================
+// Stereo block kernel, fixed coefficients (states in registers)
+template<eSVFOutput Output>
+ITCM static inline void ProcessSVF(float k, float a1, float a2, float a3, sSVFState *pState,
+                                   const AudioBlock &In, const AudioBlock &Out) {
+	sSVFState Left = pState[0];
+	sSVFState Right = pState[1];
+	for (size_t Index = 0; Index < In.Size; Index++) {
+		float xL = In.L(Index);
+		float xR = In.R(Index);
+		float v1L, v2L, v1R, v2R;
+
+		float v3L = xL - Left.ic2eq;
+		float v3R = xR - Right.ic2eq;
+		v1L = (a1 * Left.ic1eq) + (a2 * v3L);
+		v1R = (a1 * Right.ic1eq) + (a2 * v3R);
+		v2L = Left.ic2eq + (a2 * Left.ic1eq) + (a3 * v3L);
+		v2R = Right.ic2eq + (a2 * Right.ic1eq) + (a3 * v3R);
+		Left.ic1eq = (2.0f * v1L) - Left.ic1eq;
+		Right.ic1eq = (2.0f * v1R) - Right.ic1eq;
+		Left.ic2eq = (2.0f * v2L) - Left.ic2eq;
+		Right.ic2eq = (2.0f * v2R) - Right.ic2eq;
+
+		Out.L(Index) = SelectOutput<Output>(xL, k, v1L, v2L);
+		Out.R(Index) = SelectOutput<Output>(xR, k, v1R, v2R);
+	}
+	pState[0] = Left;
+	pState[1] = Right;
+}
+
+// ==========================================================================
+// process a stereo block
+void cSVF::Process(const AudioBlock &In, const AudioBlock &Out) {
+	switch (m_output) {
+	case eSVFOutput::LowPass :
+		ProcessSVF<eSVFOutput::LowPass>(m_k, m_a1, m_a2, m_a3, m_State, In, Out);
+		break;
+	case eSVFOutput::BandPass :
+		ProcessSVF<eSVFOutput::BandPass>(m_k, m_a1, m_a2, m_a3, m_State, In, Out);
+		break;
+	case eSVFOutput::HighPass :
+		ProcessSVF<eSVFOutput::HighPass>(m_k, m_a1, m_a2, m_a3, m_State, In, Out);
+		break;
+	default :
+		ProcessSVF<eSVFOutput::Notch>(m_k, m_a1, m_a2, m_a3, m_State, In, Out);
+		break;
+	}
+}
+
+// ==========================================================================
+// Stereo block kernel, cutoff of every frame
+template<eSVFOutput Output>
+ITCM static inline void ProcessModulatedSVF(const cSVF &Filter, sSVFState *pState, float k,
+                                            const AudioBlock &In, const AudioBlock &Out, const float *pCutoff) {
+	sSVFState Left = pState[0];
+	sSVFState Right = pState[1];
+	for (size_t Index = 0; Index < In.Size; Index++) {
+		float g = Filter.getPrewarpedGain(pCutoff[Index]);
+		float a1 = 1.0f / (1.0f + g * (g + k));
+		float a2 = g * a1;
+		float a3 = g * a2;
+
+		float xL = In.L(Index);
+		float xR = In.R(Index);
+		float v3L = xL - Left.ic2eq;
+		float v3R = xR - Right.ic2eq;
+		float v1L = (a1 * Left.ic1eq) + (a2 * v3L);
+		float v1R = (a1 * Right.ic1eq) + (a2 * v3R);
+		float v2L = Left.ic2eq + (a2 * Left.ic1eq) + (a3 * v3L);
+		float v2R = Right.ic2eq + (a2 * Right.ic1eq) + (a3 * v3R);
+		Left.ic1eq = (2.0f * v1L) - Left.ic1eq;
+		Right.ic1eq = (2.0f * v1R) - Right.ic1eq;
+		Left.ic2eq = (2.0f * v2L) - Left.ic2eq;
+		Right.ic2eq = (2.0f * v2R) - Right.ic2eq;
+
+		Out.L(Index) = SelectOutput<Output>(xL, k, v1L, v2L);
+		Out.R(Index) = SelectOutput<Output>(xR, k, v1R, v2R);
+	}
+	pState[0] = Left;
+	pState[1] = Right;
+}
+
+// ==========================================================================
+// process a stereo block, cutoff of every frame
+void cSVF::Process(const AudioBlock &In, const AudioBlock &Out, const float *pCutoff) {
+	if (In.Size == 0) {
+		return;
+	}
+	switch (m_output) {
+	case eSVFOutput::LowPass :
+		ProcessModulatedSVF<eSVFOutput::LowPass>(*this, m_State, m_k, In, Out, pCutoff);
+		break;
+	case eSVFOutput::BandPass :
+		ProcessModulatedSVF<eSVFOutput::BandPass>(*this, m_State, m_k, In, Out, pCutoff);
+		break;
+	case eSVFOutput::HighPass :
+		ProcessModulatedSVF<eSVFOutput::HighPass>(*this, m_State, m_k, In, Out, pCutoff);
+		break;
+	default :
+		ProcessModulatedSVF<eSVFOutput::Notch>(*this, m_State, m_k, In, Out, pCutoff);
+		break;
+	}
+	setCutoffFreq(pCutoff[In.Size - 1]);
+}
+
+} // namespace DadDSP
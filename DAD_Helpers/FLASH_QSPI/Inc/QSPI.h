@@ -8,8 +8,6 @@
 #include "main.h"
 #include <cstdint>
 
-#include "cIS25LPxxx.h"
-
 // External reference to the Daisy hardware interface
 namespace DadQSPI{
 
@@ -5,6 +5,7 @@
 // Copyright(c) 2025 Dad Design.
 //====================================================================================
 #include "QSPI.h"
+#include "cIS25LPxxx.h"
 #include "Effect.h"
 #include <cstring>
 
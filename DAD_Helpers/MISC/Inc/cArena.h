@@ -0,0 +1,61 @@
+#pragma once
+//****************************************************************************
+// Linear memory arena
+//
+// Bump allocator over a fixed memory block (SDRAM on target). Blocks are
+// never freed one by one: Reset() releases every allocation at once, e.g.
+// when the running effect is replaced by another one.
+//
+// File: cArena.h
+// Copyright (c) 2025 Dad Design.
+//****************************************************************************
+#include <cstdint>
+#include <cstddef>
+
+namespace DadMisc {
+
+//****************************************************************************
+// Class cArena
+//****************************************************************************
+class cArena {
+public:
+	// -----------------------------------------------------------------------
+	// Constructor
+	cArena() {}
+
+	// -----------------------------------------------------------------------
+	// Initialize
+	// pMemory : memory block managed by the arena
+	// Size    : size of the block in bytes
+	void Init(void *pMemory, size_t Size);
+
+	// -----------------------------------------------------------------------
+	// Allocates Size bytes aligned on Align (power of two).
+	// Calls Error_Handler() if the arena is exhausted.
+	void *Allocate(size_t Size, size_t Align = alignof(max_align_t));
+
+	// -----------------------------------------------------------------------
+	// Allocates an (uninitialized) array of Count elements of type T
+	template<typename T>
+	inline T *AllocateArray(size_t Count) {
+		return static_cast<T *>(Allocate(Count * sizeof(T), alignof(T)));
+	}
+
+	// -----------------------------------------------------------------------
+	// Releases every allocation
+	inline void Reset() { m_Used = 0; }
+
+	// -----------------------------------------------------------------------
+	// Getters
+	inline size_t getSize() const { return m_Size; }
+	inline size_t getUsed() const { return m_Used; }
+	inline size_t getPeak() const { return m_Peak; }
+
+protected:
+	uint8_t*	m_pMemory = nullptr;	// Managed memory block
+	size_t		m_Size = 0;				// Size of the block
+	size_t		m_Used = 0;				// Bytes allocated since the last Reset()
+	size_t		m_Peak = 0;				// Highest m_Used since Init()
+};
+
+} // DadMisc
@@ -0,0 +1,167 @@
+#pragma once
+//****************************************************************************
+// Deferred audio processing hand-off
+//
+// Ping-pong between the SAI DMA callbacks (capture / transmit) and a lower
+// priority DSP stage (PendSV on target).
+//
+// Lock-free on the DMA side: the callbacks cannot be preempted by the DSP
+// stage. The DSP stage masks the interrupts while it selects and claims a slot
+// (a capture between the test and the claim could otherwise re-stamp it).
+// Sequence numbers are compared modulo 2^32 and never 0 (0 = nothing yet).
+// The tick source is injected, so the same logic runs on a host with a
+// simulated clock (see Host/Tools/PendaTest.cpp).
+//
+// File: cDeferredAudio.h
+// Copyright (c) 2025 Dad Design.
+//****************************************************************************
+#include "main.h"
+#include <cstdint>
+
+namespace DadMisc {
+
+// Tick source (DWT->CYCCNT on target)
+using tClockFn = uint32_t (*)();
+
+constexpr uint8_t NB_AUDIO_SLOTS = 2;       // Ping-pong
+constexpr int8_t  NO_AUDIO_SLOT  = -1;      // No slot available
+
+// Slot life cycle: Free -> Captured -> Processing -> Ready -> Captured ...
+enum class eSlotState : uint8_t {
+	Free,
+	Captured,		// Input converted, waiting for the DSP stage
+	Processing,		// DSP stage running on the slot
+	Ready			// Output available for transmission
+};
+
+//****************************************************************************
+// Class cDeferredAudio
+//****************************************************************************
+class cDeferredAudio {
+public:
+	// -----------------------------------------------------------------------
+	// Constructor
+	cDeferredAudio() {}
+
+	// -----------------------------------------------------------------------
+	// Initialize
+	// pClock        : tick source
+	// DeadlineTicks : maximum capture to end-of-processing time (one block period)
+	void Init(tClockFn pClock, uint32_t DeadlineTicks);
+
+	// -----------------------------------------------------------------------
+	// Reset statistics
+	void reset();
+
+	// -----------------------------------------------------------------------
+	// Capture side (DMA receive callback)
+	// Returns true if the input buffer of Slot can be written: the slot is then
+	// marked Captured. Returns false if the DSP stage is still processing it
+	// (the new input block is dropped).
+	inline bool CaptureInput(uint8_t Slot) {
+		if (m_State[Slot] == eSlotState::Processing) {
+			m_DroppedCount++;
+			return false;
+		}
+		if (m_State[Slot] == eSlotState::Captured) {
+			m_DroppedCount++;				// Previous block never processed
+		}
+		m_CaptureTime[Slot] = m_pClock();
+		if (++m_CaptureSeq == 0) {
+			m_CaptureSeq = 1;				// Wrap: 0 means no block
+		}
+		m_Seq[Slot] = m_CaptureSeq;
+		m_State[Slot] = eSlotState::Captured;
+		return true;
+	}
+
+	// -----------------------------------------------------------------------
+	// DSP stage: returns the oldest captured slot (marked Processing),
+	// or NO_AUDIO_SLOT if nothing is waiting.
+	// Test and claim run with the interrupts masked.
+	inline int8_t BeginProcess() {
+		int8_t Slot = NO_AUDIO_SLOT;
+		__disable_irq();
+		for (uint8_t Index = 0; Index < NB_AUDIO_SLOTS; Index++) {
+			if ((m_State[Index] == eSlotState::Captured) &&
+				((Slot == NO_AUDIO_SLOT) || isOlder(m_Seq[Index], m_Seq[Slot]))) {
+				Slot = Index;
+			}
+		}
+		if (Slot != NO_AUDIO_SLOT) {
+			m_State[Slot] = eSlotState::Processing;
+		}
+		__enable_irq();
+		return Slot;
+	}
+
+	// -----------------------------------------------------------------------
+	// DSP stage: output of Slot is complete
+	inline void EndProcess(int8_t Slot) {
+		uint32_t Latency = m_pClock() - m_CaptureTime[Slot];
+		if (Latency > m_DeadlineTicks) {
+			m_DeadlineMissCount++;
+		}
+		if (Latency > m_MaxLatencyTicks) {
+			m_MaxLatencyTicks = Latency;
+		}
+		m_ReadySlot = Slot;
+		m_ReadySeq = m_Seq[Slot];
+		m_State[Slot] = eSlotState::Ready;
+	}
+
+	// -----------------------------------------------------------------------
+	// Transmit side (DMA transmit callback)
+	// Returns the slot whose output must be sent, or NO_AUDIO_SLOT when no new
+	// block is available in time (xrun: the caller sends silence).
+	inline int8_t OutputSlot() {
+		if (m_ReadySeq == 0) {
+			return NO_AUDIO_SLOT;			// Start-up: nothing processed yet
+		}
+		if ((m_ReadySeq == m_ConsumedSeq) ||
+			(m_State[m_ReadySlot] == eSlotState::Processing)) {
+			m_XRunCount++;
+			return NO_AUDIO_SLOT;
+		}
+		m_ConsumedSeq = m_ReadySeq;
+		return m_ReadySlot;
+	}
+
+	// -----------------------------------------------------------------------
+	// Getters
+	inline uint32_t getXRunCount() const { return m_XRunCount; }
+	inline uint32_t getDroppedCount() const { return m_DroppedCount; }
+	inline uint32_t getDeadlineMissCount() const { return m_DeadlineMissCount; }
+	inline uint32_t getMaxLatencyTicks() const { return m_MaxLatencyTicks; }
+	inline uint32_t getDeadlineTicks() const { return m_DeadlineTicks; }
+	inline eSlotState getSlotState(uint8_t Slot) const { return m_State[Slot]; }
+
+protected:
+	// -----------------------------------------------------------------------
+	// Sequence number A was captured before B (wrap-safe)
+	static inline bool isOlder(uint32_t A, uint32_t B) {
+		return static_cast<int32_t>(A - B) < 0;
+	}
+
+	// Slots
+	volatile eSlotState	m_State[NB_AUDIO_SLOTS];			// Slot states
+	volatile uint32_t	m_Seq[NB_AUDIO_SLOTS];				// Capture sequence number of each slot
+	volatile uint32_t	m_CaptureTime[NB_AUDIO_SLOTS];		// Capture time of each slot
+
+	volatile uint32_t	m_CaptureSeq;		// Last capture sequence number
+	volatile uint32_t	m_ReadySeq;			// Sequence number of the last processed block
+	volatile uint32_t	m_ConsumedSeq;		// Sequence number of the last transmitted block
+	volatile int8_t		m_ReadySlot;		// Slot of the last processed block
+
+	// Statistics
+	volatile uint32_t	m_XRunCount;			// Transmit found no new block
+	volatile uint32_t	m_DroppedCount;			// Input blocks lost before processing
+	volatile uint32_t	m_DeadlineMissCount;	// Blocks processed after their deadline
+	volatile uint32_t	m_MaxLatencyTicks;		// Worst capture to end-of-processing time
+
+	// Configuration
+	tClockFn			m_pClock = nullptr;
+	uint32_t			m_DeadlineTicks;
+};
+
+} // DadMisc
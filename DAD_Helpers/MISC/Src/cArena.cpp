@@ -0,0 +1,42 @@
+//****************************************************************************
+// Linear memory arena
+//
+// File: cArena.cpp
+// Copyright (c) 2025 Dad Design.
+//****************************************************************************
+#include "cArena.h"
+#include "main.h"
+
+namespace DadMisc {
+
+//****************************************************************************
+// Class cArena
+//****************************************************************************
+
+// -----------------------------------------------------------------------
+// Initialize
+void cArena::Init(void *pMemory, size_t Size) {
+	m_pMemory = static_cast<uint8_t *>(pMemory);
+	m_Size = Size;
+	m_Used = 0;
+	m_Peak = 0;
+}
+
+// -----------------------------------------------------------------------
+// Allocates Size bytes aligned on Align
+void *cArena::Allocate(size_t Size, size_t Align) {
+	uintptr_t Base = reinterpret_cast<uintptr_t>(m_pMemory);
+	uintptr_t Start = (Base + m_Used + (Align - 1)) & ~(static_cast<uintptr_t>(Align) - 1);
+	size_t Offset = static_cast<size_t>(Start - Base);
+	if ((m_pMemory == nullptr) || (Offset + Size > m_Size)) {
+		Error_Handler();					// The arena is sized for the largest effect
+		return nullptr;
+	}
+	m_Used = Offset + Size;
+	if (m_Used > m_Peak) {
+		m_Peak = m_Used;
+	}
+	return reinterpret_cast<void *>(Start);
+}
+
+} // DadMisc
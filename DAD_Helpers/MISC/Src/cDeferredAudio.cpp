@@ -0,0 +1,42 @@
+//****************************************************************************
+// Deferred audio processing hand-off
+//
+// File: cDeferredAudio.cpp
+// Copyright (c) 2025 Dad Design.
+//****************************************************************************
+#include "cDeferredAudio.h"
+
+namespace DadMisc {
+
+//****************************************************************************
+// Class cDeferredAudio
+//****************************************************************************
+
+// -----------------------------------------------------------------------
+// Initialize
+void cDeferredAudio::Init(tClockFn pClock, uint32_t DeadlineTicks) {
+	m_pClock = pClock;
+	m_DeadlineTicks = DeadlineTicks;
+
+	for (uint8_t Index = 0; Index < NB_AUDIO_SLOTS; Index++) {
+		m_State[Index] = eSlotState::Free;
+		m_Seq[Index] = 0;
+		m_CaptureTime[Index] = 0;
+	}
+	m_CaptureSeq = 0;
+	m_ReadySeq = 0;
+	m_ConsumedSeq = 0;
+	m_ReadySlot = 0;
+	reset();
+}
+
+// -----------------------------------------------------------------------
+// Reset statistics
+void cDeferredAudio::reset() {
+	m_XRunCount = 0;
+	m_DroppedCount = 0;
+	m_DeadlineMissCount = 0;
+	m_MaxLatencyTicks = 0;
+}
+
+} // DadMisc
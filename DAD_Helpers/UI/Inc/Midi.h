@@ -14,24 +14,24 @@
 #define MULTI_CHANNEL 0xFF
 
 // Function type definitions for MIDI callbacks
-using ControlChangeCallback = std::function<void(uint8_t control, uint8_t value, uint32_t userData)>;
-using ProgramChangeCallback = std::function<void(uint8_t program, uint32_t userData)>;
-using NoteChangeCallback = std::function<void(uint8_t OnOff, uint8_t note, uint8_t velocity, uint32_t userData)>;
+using ControlChangeCallback = std::function<void(uint8_t control, uint8_t value, uintptr_t userData)>;
+using ProgramChangeCallback = std::function<void(uint8_t program, uintptr_t userData)>;
+using NoteChangeCallback = std::function<void(uint8_t OnOff, uint8_t note, uint8_t velocity, uintptr_t userData)>;
 
 // Structures to store callback information
 struct CC_CallbackEntry {
     uint8_t control;                 // Control Change number (0-127)
-    uint32_t userData;				 // User data
+    uintptr_t userData;				 // User data
     ControlChangeCallback callback;  // Function to call when this CC is received
 };
 
 struct PC_CallbackEntry {
-    uint32_t userData;				 // User data
+    uintptr_t userData;				 // User data
     ProgramChangeCallback callback;  // Function to call when this PC is received
 };
 
 struct Note_CallbackEntry {
-    uint32_t userData;				 // User data
+    uintptr_t userData;				 // User data
     NoteChangeCallback callback;     // Function to call when Note On/Off is received
 };
 
@@ -69,7 +69,7 @@ public:
     // @param channel - MIDI channel (0-15)
     // @param control - Control Change number (0-127)
     // @param pCallback - Function to call when this CC is received
-    void addControlChangeCallback(uint8_t control, uint32_t userData, ControlChangeCallback pCallback);
+    void addControlChangeCallback(uint8_t control, uintptr_t userData, ControlChangeCallback pCallback);
 
     // --------------------------------------------------------------------------
     // Remove a previously registered Control Change callback
@@ -81,7 +81,7 @@ public:
     // @param channel - MIDI channel (0-15)
     // @param program - Program Change number (0-127)
     // @param pCallback - Function to call when this PC is received
-    void addProgramChangeCallback(uint32_t userData, ProgramChangeCallback pCallback);
+    void addProgramChangeCallback(uintptr_t userData, ProgramChangeCallback pCallback);
 
     // --------------------------------------------------------------------------
     // Remove a previously registered Program Change callback
@@ -92,13 +92,18 @@ public:
     // Register a callback for Note On/Off messages on a specific channel
     // @param channel - MIDI channel (0-15)
     // @param pCallback - Function to call when Note messages are received
-    void addNoteChangeCallback(uint32_t userData, NoteChangeCallback pCallback);
+    void addNoteChangeCallback(uintptr_t userData, NoteChangeCallback pCallback);
 
     // --------------------------------------------------------------------------
     // Remove a previously registered Note callback
     // @param pCallback - The callback function to remove
     void removeNoteChangeCallback(NoteChangeCallback pCallback);
 
+    // --------------------------------------------------------------------------
+    // Remove every callback (CC, PC and Note) registered with userData
+    // @param userData - User data given when the callbacks were added
+    void removeCallbacks(uintptr_t userData);
+
 protected:
     // --------------------------------------------------------------------------
     // Handle Note On MIDI messages
@@ -24,7 +24,7 @@ namespace DadUI {
 class cParameter;
 // Define the callback function type:
 // This callback is called whenever the parameter value is modified.
-using CallbackType = std::function<void(cParameter*, uint32_t UserData)>;
+using CallbackType = std::function<void(cParameter*, uintptr_t UserData)>;
 
 class cParameter : public iGUIObject{
 
@@ -36,7 +36,7 @@ public:
     void Init(float 		InitValue, 		float Min, 			float Max,
 			  float 		RapidIncrement, float SlowIncrement,
 			  CallbackType 	Callback = nullptr,
-			  uint32_t		CallbackUserData = 0,
+			  uintptr_t		CallbackUserData = 0,
 			  float 		Slope = 0,
 			  uint8_t 		Control = 0xFF,
 			  uint32_t 		SerializeID = 0);
@@ -169,7 +169,7 @@ public:
 
     // --------------------------------------------------------------------------
     // Function call when this CC is received
-    static void MIDIControlChangeCallBack(uint8_t control, uint8_t value, uint32_t userData);
+    static void MIDIControlChangeCallBack(uint8_t control, uint8_t value, uintptr_t userData);
 
 protected:
     // --------------------------------------------------------------------------
@@ -180,13 +180,13 @@ protected:
     float 		m_RapidIncrement = 0.1f;  	// Increment step size (rapid)
     float 		m_SlowIncrement = 0.01f;	// Increment step size (slow)
     float 		m_Value = 0.0;           	// Current value
-    float 		m_Step;        				// Step change value to 1/m_SamplingRate;
-    float 		m_TargetValue;  			// Target parameter value
-    float 		m_Slope;
+    float 		m_Step = 0.0f;     			// Step change value to 1/m_SamplingRate;
+    float 		m_TargetValue = 0.0f;		// Target parameter value
+    float 		m_Slope = 0.0f;
     uint32_t	m_SerializeID = 0; 			// Unique ID for serialization
     CallbackType m_Callback;        		// Callback function
-    uint32_t	m_CallbackUserData;		    // Callback user data
-    bool 		m_Dirty;
+    uintptr_t	m_CallbackUserData = 0;	    // Callback user data
+    bool 		m_Dirty = false;
 
 };
 
@@ -14,13 +14,14 @@
 #include "UIDefines.h"
 #include "Midi.h"
 #include "cVolume.h"
+#include <atomic>
 #include <vector>
 #include <stack>
 
 // --------------------------------------------------------------------------
 // Global references
 extern DadGFX::cDisplay	__Display;  // External reference to the display object
-constexpr float UIRT_RATE = SAMPLING_RATE / (float) AUDIO_BUFFER_SIZE;
+#define UIRT_RATE UI_RT_SAMPLING_RATE		// Real-time UI rate (depends on the audio block size)
 namespace DadUI{
 class iGUIObject;
 
@@ -33,8 +34,16 @@ public:
 		m_TabGUIObject.clear();
 	}
 
+	// Static destruction (host exit): the GUI objects destroyed later must not
+	// touch the list any more
+	~cUIObjectManager(){
+		m_Destroyed = true;
+	}
+
 	// Array of cGUIObject for serialization and real-time process
     std::vector<iGUIObject*> m_TabGUIObject;  // List of GUI objects
+
+    static bool m_Destroyed;                  // The manager no longer exists
 };
 
 //***********************************************************************************
@@ -87,6 +96,24 @@ public:
     // Check if an object currently has focus
     static uint8_t HasFocus(iGUIObject* pGUIObject);
 
+    // --------------------------------------------------------------------------
+    // Deactivate the active object and release every focus
+    // (before the objects of the user interface are destroyed)
+    static void ReleaseActiveObject();
+
+    // --------------------------------------------------------------------------
+    // Suspend/resume the real-time processing of the GUI objects
+    // (while objects are created or destroyed from the main loop).
+    // The compiler barriers keep the object list accesses on their side of the
+    // flag; the memory barrier orders them for the audio interrupt.
+    static inline void LockRTProcess(bool Lock) {
+    	std::atomic_signal_fence(std::memory_order_seq_cst);
+    	__DMB();
+    	m_RTLocked = Lock;
+    	__DMB();
+    	std::atomic_signal_fence(std::memory_order_seq_cst);
+    }
+
 	//--------------------------------------------------------------
 	// Data members
 
@@ -147,6 +174,8 @@ protected:
 	static iGUIObject*	 	m_pActiveObject;  		// Currently active GUI object
 
     static std::stack<iGUIObject*> m_MainFocusStack; // Stack of Main focus
+
+    static volatile bool	m_RTLocked;				// GUI objects real-time processing suspended
 };
 
 //***********************************************************************************
@@ -157,7 +186,7 @@ class iGUIObject : public DadQSPI::cSerializedObject {
 public:
 	iGUIObject();
 
-	virtual ~iGUIObject(){}
+	virtual ~iGUIObject();
 	virtual void Activate(){};  		// Activate the object
 	virtual void DeActivate(){};  		// Deactivate the object
 
@@ -145,19 +145,19 @@ public:
 
     // --------------------------------------------------------------------------
     // Function call when this CC MIDI_PRESET_UP is received
-    static void MIDI_PresetUp_CallBack(uint8_t control, uint8_t value, uint32_t userData);
+    static void MIDI_PresetUp_CallBack(uint8_t control, uint8_t value, uintptr_t userData);
 
     // --------------------------------------------------------------------------
     // Function call when this CC MIDI_PRESET_DOWN is received
-    static void MIDI_PresetDown_CallBack(uint8_t control, uint8_t value, uint32_t userData);
+    static void MIDI_PresetDown_CallBack(uint8_t control, uint8_t value, uintptr_t userData);
 
     // --------------------------------------------------------------------------
     // Function call when this CC MIDI_ON_OFF is received
-    static void MIDI_OnOff_CallBack(uint8_t control, uint8_t value, uint32_t userData);
+    static void MIDI_OnOff_CallBack(uint8_t control, uint8_t value, uintptr_t userData);
 
     // --------------------------------------------------------------------------
     // Function call when this PC MIDI is received
-    static void MIDI_ProgramChange_CallBack(uint8_t program, uint32_t userData);
+    static void MIDI_ProgramChange_CallBack(uint8_t program, uintptr_t userData);
 
 protected:
     // --------------------------------------------------------------------------
@@ -5,6 +5,7 @@
 // Copyright (c) 2025 Dad Design. All rights reserved.
 //====================================================================================
 #include "main.h"
+#include "AudioBlock.h"
 #include "PendaUI.h"
 #include "Parameter.h"
 #include "cDisplay.h"
@@ -14,6 +15,7 @@
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wmultichar"
 constexpr uint32_t SysSerializeID ='Sys0'; // SerializeID for System
+constexpr uint32_t AudioSerializeID ='Aud0'; // SerializeID for audio block size (read at boot)
 #pragma GCC diagnostic pop
 
 namespace DadUI {
@@ -55,7 +57,14 @@ public:
     // Description: Processes audio samples to update meter values
     // Parameters:
     //   pIn - Pointer to audio buffer containing samples
-    void Process(AudioBuffer *pIn);
+    void Process(const AudioBuffer *pIn);
+
+    // ------------------------------------------------------------------------------
+    // Function: Process
+    // Description: Processes a block of audio frames to update meter values
+    // Parameters:
+    //   In - Block of audio frames
+    void Process(const AudioBlock &In);
 
     // ------------------------------------------------------------------------------
     // Function: OnMainFocusLost
@@ -105,6 +114,120 @@ protected:
     float       m_CtIntegration;       // Integration constant for meter ballistics
 };
 
+// Constants for the frequency response view
+#define RESPONSE_POINTS 100        // Number of frequencies evaluated for the curve
+#define RESPONSE_X 10              // Curve area in the main lower layer (pixels)
+#define RESPONSE_Y 6
+#define RESPONSE_WIDTH 300
+#define RESPONSE_HEIGHT 78
+
+// Gains in dB of Count frequencies (batch evaluation of a filter response)
+using tResponseCallback = void (*)(const float *pFreq, float *pGainDb, size_t Count, uintptr_t CallbackUserData);
+
+//***********************************************************************************
+// class cUIResponseView
+// Description: Draws the frequency response curve of a filter (EQ), evaluated
+//              in one batch on a log frequency scale when it has changed
+//***********************************************************************************
+class cUIResponseView : public iGUIObject {
+public:
+    // ------------------------------------------------------------------------------
+    // Constructor
+    cUIResponseView() {}
+
+    // ------------------------------------------------------------------------------
+    // Destructor
+    virtual ~cUIResponseView() {}
+
+    // ------------------------------------------------------------------------------
+    // Function: Init
+    // Description: Initializes the frequency scale and the response callback
+    // Parameters:
+    //   Callback - Evaluates the response at RESPONSE_POINTS frequencies
+    //   CallbackUserData - User data of the callback
+    //   MinFreq, MaxFreq - Frequency scale (Hz, logarithmic)
+    //   RangeDb - Gain scale (+/- RangeDb)
+    void Init(tResponseCallback Callback, uintptr_t CallbackUserData, float MinFreq, float MaxFreq, float RangeDb);
+
+    // ------------------------------------------------------------------------------
+    // Function: setDirty
+    // Description: The response has changed (may be called from parameter callbacks)
+    inline void setDirty() { m_Dirty = true; }
+
+    // ------------------------------------------------------------------------------
+    // Function: Draw
+    // Description: Evaluates and redraws the curve if the response has changed
+    void Draw();
+
+    // ------------------------------------------------------------------------------
+    // Function: OnMainFocusLost
+    // Description: Called when this view loses focus
+    void OnMainFocusLost() override;
+
+    // ------------------------------------------------------------------------------
+    // Function: drawMainDownStat
+    // Description: Draws the static elements of the view (frame and grid)
+    void drawMainDownStat();
+
+    // ------------------------------------------------------------------------------
+    // Function: OnMainFocusGained
+    // Description: Called when this view gains focus
+    void OnMainFocusGained() override;
+
+protected:
+    // ------------------------------------------------------------------------------
+    // Function: FreqToX / GainToY
+    // Description: Converts a frequency or a gain to a pixel position
+    uint16_t FreqToX(float Freq);
+    uint16_t GainToY(float GainDb);
+
+    // ------------------------------------------------------------------------------
+    // Member variables
+    tResponseCallback   m_Callback;                     // Batch response evaluation
+    uintptr_t           m_CallbackUserData;
+    float               m_MinFreq;                      // Frequency scale
+    float               m_MaxFreq;
+    float               m_RangeDb;                      // Gain scale
+    float               m_Freq[RESPONSE_POINTS];        // Evaluated frequencies
+    float               m_GainDb[RESPONSE_POINTS];      // Last evaluated gains
+    volatile bool       m_Dirty;                        // Response changed since the last draw
+};
+
+//***********************************************************************************
+// class cUIResponseParameters
+// Description: Parameter page showing a frequency response curve in the main view
+//***********************************************************************************
+class cUIResponseParameters : public cUIParameters {
+public:
+    // ------------------------------------------------------------------------------
+    // Constructor
+    cUIResponseParameters() {}
+
+    // ------------------------------------------------------------------------------
+    // Function: Init
+    // Description: Initializes the parameter views and the (shared) response view
+    void Init(cParameterView* paramView1, cParameterView* paramView2, cParameterView* paramView3,
+              cUIResponseView *pResponseView);
+
+    // ------------------------------------------------------------------------------
+    // Function: Activate
+    // Description: Activates the page and requests focus for the response view
+    void Activate() override;
+
+    // ------------------------------------------------------------------------------
+    // Function: DeActivate
+    // Description: Deactivates the page and releases focus
+    void DeActivate() override;
+
+    // ------------------------------------------------------------------------------
+    // Function: Update
+    // Description: Updates the page and redraws the response if it has changed
+    void Update() override;
+
+protected:
+    cUIResponseView     *m_pResponseView = nullptr;    // Response view
+};
+
 //***********************************************************************************
 // class cUIImputVolume
 // Description: Implements the input volume control UI with VU meters
@@ -140,29 +263,57 @@ public:
     // Description: Processes audio samples for the VU meter
     // Parameters:
     //   pIn - Pointer to audio buffer
-    inline void Process(AudioBuffer *pIn) {
+    inline void Process(const AudioBuffer *pIn) {
         m_UIVuMeterView.Process(pIn);
     }
 
+    // ------------------------------------------------------------------------------
+    // Function: Process
+    // Description: Processes a block of audio frames for the VU meter
+    // Parameters:
+    //   In - Block of audio frames
+    inline void Process(const AudioBlock &In) {
+        m_UIVuMeterView.Process(In);
+    }
+
     // ------------------------------------------------------------------------------
     // Static Function: VolumePanChange
     // Description: Callback for volume/pan parameter changes
     // Parameters:
     //   pParameter - The changed parameter
     //   CallbackUserData - Pointer to this instance
-    static void VolumePanChange(DadUI::cParameter *pParameter, uint32_t CallbackUserData);
+    static void VolumePanChange(DadUI::cParameter *pParameter, uintptr_t CallbackUserData);
+
+    // ------------------------------------------------------------------------------
+    // Static Function: LoadAudioBufferSize
+    // Description: Reads the audio block size setting from persistent storage.
+    //              Called at boot, before the UI and the effect are initialized.
+    // Returns: Block size in frames (AUDIO_BUFFER_SIZE_DEFAULT if not saved)
+    static uint32_t LoadAudioBufferSize();
 
 protected:
+    // ------------------------------------------------------------------------------
+    // Function: BlockSizeIndexToFrames
+    // Description: Converts the block size parameter index to frames (4 << Index)
+    static inline uint32_t BlockSizeIndexToFrames(uint32_t Index) {
+        return AUDIO_BUFFER_SIZE_MIN << Index;
+    }
+    static constexpr uint32_t BLOCK_SIZE_INDEX_MAX = 4;			// 64 frames
+    static_assert((AUDIO_BUFFER_SIZE_MIN << BLOCK_SIZE_INDEX_MAX) == AUDIO_BUFFER_SIZE_MAX, "Block size index range");
+
     // ------------------------------------------------------------------------------
     // Member variables
     DadUI::cParameter           m_InputVolume;		// Volume parameter
     DadUI::cParameter           m_InputPanning;     // Pan parameter
+    DadUI::cParameter           m_BlockSize;        // Audio block size (applied at next boot)
 
     cParameterNumNormalView     m_InputVolumeView;  // Volume parameter view
     cParameterNumLeftRightView  m_InputPanningView; // Pan parameter view
+    cParameterDiscretView       m_BlockSizeView;    // Audio block size view
 
     float     					m_MemInputVolume;  	// Volume parameter view
     float						m_MemInputPanning; 	// Pan parameter view
+    float						m_MemBlockSize;		// Block size parameter value
 
     cUIVuMeterView              m_UIVuMeterView;    // VU meter visualization
 };
@@ -14,11 +14,12 @@
 namespace DadUI {
 
 // Timing constants derived from audio system parameters
-constexpr float UIRT_RATE2 = SAMPLING_RATE / (float)AUDIO_BUFFER_SIZE;  // Conversion factor between samples and time
-constexpr uint32_t kUpdateTime = static_cast<uint32_t>(UIRT_RATE2 * 0.02f);   // 20ms default debounce interval
-constexpr uint32_t kMinPeriod = static_cast<uint32_t>(UIRT_RATE2 * 0.15f);    // 150ms minimum valid period
-constexpr uint32_t kMaxPeriod = static_cast<uint32_t>(UIRT_RATE2 * 1.1f);     // 1.1s maximum valid period
-constexpr uint32_t kAbordMaxPeriod = static_cast<uint32_t>(UIRT_RATE2 * 1.5f); // 1.5s timeout period
+// (evaluated at run time: the audio block size is selected at boot)
+#define UIRT_RATE2 UI_RT_SAMPLING_RATE  // Conversion factor between samples and time
+inline uint32_t kUpdateTime()     { return static_cast<uint32_t>(UIRT_RATE2 * 0.02f); }  // 20ms default debounce interval
+inline uint32_t kMinPeriod()      { return static_cast<uint32_t>(UIRT_RATE2 * 0.15f); }  // 150ms minimum valid period
+inline uint32_t kMaxPeriod()      { return static_cast<uint32_t>(UIRT_RATE2 * 1.1f); }   // 1.1s maximum valid period
+inline uint32_t kAbordMaxPeriod() { return static_cast<uint32_t>(UIRT_RATE2 * 1.5f); }   // 1.5s timeout period
 
 //***********************************************************************************
 // cSwitch - Digital switch debouncer with advanced timing analysis
@@ -40,10 +41,10 @@ class cSwitch
     // @param MaxPeriod      Maximum valid period between presses
     // @param AbordMaxPeriod Absolute timeout period for resetting tracking
     void Init(GPIO_TypeDef* pPort, uint16_t Pin,
-              uint32_t UpdateInterval = kUpdateTime,
-              uint32_t MinPeriod = kMinPeriod,
-              uint32_t MaxPeriod = kMaxPeriod,
-              uint32_t AbordMaxPeriod = kAbordMaxPeriod);
+              uint32_t UpdateInterval = kUpdateTime(),
+              uint32_t MinPeriod = kMinPeriod(),
+              uint32_t MaxPeriod = kMaxPeriod(),
+              uint32_t AbordMaxPeriod = kAbordMaxPeriod());
 
     // -----------------------------------------------------------------------------
     // Processes switch input with debouncing and state tracking
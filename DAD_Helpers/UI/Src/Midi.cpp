@@ -86,7 +86,7 @@ void cMidi::ProcessBuffer(){
 // @param channel - MIDI channel (0-15)
 // @param control - Control Change number (0-127)
 // @param pCallback - Function to call when this CC is received
-void cMidi::addControlChangeCallback(uint8_t control, uint32_t userData, ControlChangeCallback pCallback) {
+void cMidi::addControlChangeCallback(uint8_t control, uintptr_t userData, ControlChangeCallback pCallback) {
 	// Add the entry to the vector of callbacks
 	m_ccCallbacks.push_back({control, userData, pCallback});
 }
@@ -112,7 +112,7 @@ void cMidi::removeControlChangeCallback(ControlChangeCallback pCallback) {
 // @param channel - MIDI channel (0-15)
 // @param program - Program Change number (0-127)
 // @param pCallback - Function to call when this PC is received
-void cMidi::addProgramChangeCallback(uint32_t userData, ProgramChangeCallback pCallback) {
+void cMidi::addProgramChangeCallback(uintptr_t userData, ProgramChangeCallback pCallback) {
 	// Add the entry to the vector of callbacks
 	m_pcCallbacks.push_back({userData, pCallback});
 }
@@ -137,7 +137,7 @@ void cMidi::removeProgramChangeCallback(ProgramChangeCallback pCallback) {
 // Register a callback for Note On/Off messages on a specific channel
 // @param channel - MIDI channel (0-15)
 // @param pCallback - Function to call when Note messages are received
-void cMidi::addNoteChangeCallback(uint32_t userData, NoteChangeCallback pCallback) {
+void cMidi::addNoteChangeCallback(uintptr_t userData, NoteChangeCallback pCallback) {
 	// Add the entry to the vector of callbacks
 	m_noteCallbacks.push_back({userData, pCallback});
 }
@@ -158,6 +158,21 @@ void cMidi::removeNoteChangeCallback(NoteChangeCallback pCallback) {
 	}
 }
 
+// --------------------------------------------------------------------------
+// Remove every callback (CC, PC and Note) registered with userData
+// @param userData - User data given when the callbacks were added
+void cMidi::removeCallbacks(uintptr_t userData) {
+	for (auto it = m_ccCallbacks.begin(); it != m_ccCallbacks.end(); ) {
+		it = (it->userData == userData) ? m_ccCallbacks.erase(it) : it + 1;
+	}
+	for (auto it = m_pcCallbacks.begin(); it != m_pcCallbacks.end(); ) {
+		it = (it->userData == userData) ? m_pcCallbacks.erase(it) : it + 1;
+	}
+	for (auto it = m_noteCallbacks.begin(); it != m_noteCallbacks.end(); ) {
+		it = (it->userData == userData) ? m_noteCallbacks.erase(it) : it + 1;
+	}
+}
+
 // --------------------------------------------------------------------------
 // Handle Note On MIDI messages
 // @param channel - MIDI channel (0-15)
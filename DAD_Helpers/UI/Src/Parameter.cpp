@@ -15,7 +15,7 @@ namespace DadUI {
 // Initialize the parameter with given attributes
 void cParameter::Init(float InitValue, float Min, float Max,
 					  float RapidIncrement, float SlowIncrement,
-					  CallbackType Callback, uint32_t CallbackUserData,
+					  CallbackType Callback, uintptr_t CallbackUserData,
 					  float Slope,
 					  uint8_t Control,
 					  uint32_t SerializeID) {
@@ -34,7 +34,7 @@ void cParameter::Init(float InitValue, float Min, float Max,
     m_Slope = Slope;
 
     if(Control != 0xFF){
-    	cPendaUI::m_Midi.addControlChangeCallback(Control, (uint32_t) this, MIDIControlChangeCallBack );
+    	cPendaUI::m_Midi.addControlChangeCallback(Control, (uintptr_t) this, MIDIControlChangeCallBack );
     }
 
     m_SerializeID = SerializeID;
@@ -94,7 +94,7 @@ void cParameter::Increment(int32_t nbStep, bool Switch) {
 
 // --------------------------------------------------------------------------
 // Function call when this CC is received
-void cParameter::MIDIControlChangeCallBack(uint8_t control, uint8_t value, uint32_t userData){
+void cParameter::MIDIControlChangeCallBack(uint8_t control, uint8_t value, uintptr_t userData){
 	cParameter *pThis = (cParameter *)userData;
 	value = value > 127 ? 127 : value;
 	float NewVal = pThis->m_Min + (value * (pThis->m_Max - pThis->m_Min)) / 127.0;
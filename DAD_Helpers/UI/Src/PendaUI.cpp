@@ -5,6 +5,7 @@
 // Copyright (c) 2025 Dad Design. All rights reserved.
 //====================================================================================
 #include "PendaUI.h"
+#include <cmath>
 //=======================================================================================
 // Declare graphical layers for the interface
 
@@ -42,6 +43,8 @@ extern DadUI::cUIObjectManager __UIObjManager;
 
 namespace DadUI{
 
+bool cUIObjectManager::m_Destroyed = false;		// Constant initialization: valid in any static destruction order
+
 //***********************************************************************************
 // class cPendaUI
 //***********************************************************************************
@@ -99,6 +102,7 @@ DadMisc::cVolume cPendaUI::m_Volumes;			// Volume Manager
 iGUIObject*	 	cPendaUI::m_pActiveObject;  	// Currently active GUI object
 
 std::stack<iGUIObject*> cPendaUI::m_MainFocusStack;// Stack of Main focus
+volatile bool	cPendaUI::m_RTLocked = false;	// GUI objects real-time processing suspended
 
 eOnOff 			cPendaUI::m_AudioState;
 
@@ -108,8 +112,14 @@ eOnOff 			cPendaUI::m_AudioState;
 void cPendaUI::Init(const char* pSplashTxt1, const char* pSplashTxt2, UART_HandleTypeDef *phuart, TIM_HandleTypeDef* phtim6){
 
 
-	constexpr uint32_t EncoderUpdatePeriodMs = UIRT_RATE * 0.001f;  // 1  ms Encoder update period in milliseconds
-	constexpr uint32_t SwitchUpdatePeriodMs = UIRT_RATE * 0.005f;   // 5  ms  Switch update period in milliseconds
+	// Periods are counted in real-time UI ticks: they follow the audio block size.
+	// cEncoder updates when its counter exceeds the period, i.e. every period + 1 ticks.
+	auto TicksPeriod = [](float Seconds) -> uint32_t {
+		int32_t Ticks = static_cast<int32_t>(lroundf(UIRT_RATE * Seconds));
+		return (Ticks > 1) ? static_cast<uint32_t>(Ticks - 1) : 0;
+	};
+	const uint32_t EncoderUpdatePeriodMs = TicksPeriod(0.001f);  // 1  ms Encoder update period
+	const uint32_t SwitchUpdatePeriodMs = TicksPeriod(0.005f);   // 5  ms  Switch update period
 
 	// Initialize each encoder with its respective pins.
 	m_Encoder0.Init(Encoder0_A_GPIO_Port, Encoder0_A_Pin,
@@ -287,8 +297,11 @@ eOnOff cPendaUI::RTProcess() {
 	m_Encoder3Increment += m_Encoder3.getIncrement();  // Update encoder 3 increment
 
 	// Process all GUI objects in real-time
-	for(iGUIObject *pObject : __UIObjManager.m_TabGUIObject){
-		pObject->RTProcess();
+	if(!m_RTLocked){
+		std::atomic_signal_fence(std::memory_order_seq_cst);	// List read after the flag
+		for(iGUIObject *pObject : __UIObjManager.m_TabGUIObject){
+			pObject->RTProcess();
+		}
 	}
 
 	return m_AudioState;
@@ -376,6 +389,18 @@ uint8_t cPendaUI::HasFocus(iGUIObject* pGUIObject){
     }
 }
 
+// --------------------------------------------------------------------------
+// Deactivate the active object and release every focus
+void cPendaUI::ReleaseActiveObject(){
+	if(nullptr != m_pActiveObject){
+		m_pActiveObject->DeActivate();  // Deactivate the current object
+		m_pActiveObject = nullptr;
+	}
+	while(!m_MainFocusStack.empty()){
+		ReleaseFocus();
+	}
+}
+
 //***********************************************************************************
 // class iGUIObject
 //***********************************************************************************
@@ -383,4 +408,23 @@ iGUIObject::iGUIObject(){
 	__UIObjManager.m_TabGUIObject.push_back(this);  // Add the object to the list
 }
 
+// --------------------------------------------------------------------------
+// Remove the object from the list and from the MIDI callbacks
+// (called from the main loop only, with the real-time processing locked)
+iGUIObject::~iGUIObject(){
+	// Static object destroyed at host exit after the manager: the list, and
+	// possibly the MIDI callbacks, are gone already
+	if(cUIObjectManager::m_Destroyed){
+		return;
+	}
+	std::vector<iGUIObject*> &TabGUIObject = __UIObjManager.m_TabGUIObject;
+	for(auto it = TabGUIObject.begin(); it != TabGUIObject.end(); ++it){
+		if(*it == this){
+			TabGUIObject.erase(it);
+			break;
+		}
+	}
+	cPendaUI::m_Midi.removeCallbacks((uintptr_t) this);
+}
+
 } // DadUI
@@ -204,12 +204,12 @@ void cUIMemory::Init(uint32_t SerializeID) {
 	RestoreSlot();                    					// Restore data from the active slot
 	cPendaUI::RequestFocus(this);     					// Request UI focus
 	m_PressCount = 0;
-	cPendaUI::m_Midi.addControlChangeCallback(MIDI_PRESET_UP, (uint32_t) this, MIDI_PresetUp_CallBack );
-	cPendaUI::m_Midi.addControlChangeCallback(MIDI_PRESET_DOWN, (uint32_t) this, MIDI_PresetDown_CallBack );
-	cPendaUI::m_Midi.addControlChangeCallback(MIDI_ON_OFF, (uint32_t) this, MIDI_OnOff_CallBack );
-	cPendaUI::m_Midi.addControlChangeCallback(MIDI_ON, (uint32_t) this, MIDI_OnOff_CallBack );
-	cPendaUI::m_Midi.addControlChangeCallback(MIDI_OFF, (uint32_t) this, MIDI_OnOff_CallBack );
-	cPendaUI::m_Midi.addProgramChangeCallback((uint32_t) this, MIDI_ProgramChange_CallBack);
+	cPendaUI::m_Midi.addControlChangeCallback(MIDI_PRESET_UP, (uintptr_t) this, MIDI_PresetUp_CallBack );
+	cPendaUI::m_Midi.addControlChangeCallback(MIDI_PRESET_DOWN, (uintptr_t) this, MIDI_PresetDown_CallBack );
+	cPendaUI::m_Midi.addControlChangeCallback(MIDI_ON_OFF, (uintptr_t) this, MIDI_OnOff_CallBack );
+	cPendaUI::m_Midi.addControlChangeCallback(MIDI_ON, (uintptr_t) this, MIDI_OnOff_CallBack );
+	cPendaUI::m_Midi.addControlChangeCallback(MIDI_OFF, (uintptr_t) this, MIDI_OnOff_CallBack );
+	cPendaUI::m_Midi.addProgramChangeCallback((uintptr_t) this, MIDI_ProgramChange_CallBack);
 
 }
 
@@ -518,21 +518,21 @@ void cUIMemory::RestoreSlot() {
 
 // --------------------------------------------------------------------------
 // Function call when this CC MIDI_PRESET_UP is received
-void cUIMemory::MIDI_PresetUp_CallBack(uint8_t control, uint8_t value, uint32_t userData){
+void cUIMemory::MIDI_PresetUp_CallBack(uint8_t control, uint8_t value, uintptr_t userData){
 	cUIMemory *pThis = (cUIMemory *)userData;
 	pThis->IncrementSlot(+1);
 }
 
 // --------------------------------------------------------------------------
 // Function call when this CC MIDI_PRESET_DOWN is received
-void cUIMemory::MIDI_PresetDown_CallBack(uint8_t control, uint8_t value, uint32_t userData){
+void cUIMemory::MIDI_PresetDown_CallBack(uint8_t control, uint8_t value, uintptr_t userData){
 	cUIMemory *pThis = (cUIMemory *)userData;
 	pThis->IncrementSlot(-1);
 }
 
 // --------------------------------------------------------------------------
 // Function call when this CC MIDI_ON_OFF is received
-void cUIMemory::MIDI_OnOff_CallBack(uint8_t control, uint8_t value, uint32_t userData){
+void cUIMemory::MIDI_OnOff_CallBack(uint8_t control, uint8_t value, uintptr_t userData){
 	cUIMemory *pThis = (cUIMemory *)userData;
 	switch(control){
 	case MIDI_ON_OFF :
@@ -551,7 +551,7 @@ void cUIMemory::MIDI_OnOff_CallBack(uint8_t control, uint8_t value, uint32_t use
 
 // --------------------------------------------------------------------------
 // Function call when this PC MIDI is received
-void cUIMemory::MIDI_ProgramChange_CallBack(uint8_t program, uint32_t userData){
+void cUIMemory::MIDI_ProgramChange_CallBack(uint8_t program, uintptr_t userData){
 	cUIMemory *pThis = (cUIMemory *)userData;
 
 	program = program;
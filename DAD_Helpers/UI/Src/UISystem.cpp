@@ -4,6 +4,7 @@
 // Copyright (c) 2025 Dad Design. All rights reserved.
 //====================================================================================
 #include "UISystem.h"
+#include "FastMath.h"
 
 namespace DadUI {
 
@@ -122,11 +123,23 @@ void cUIVuMeterView::Draw() {
 // Description: Processes audio samples to update meter values
 // Parameters:
 //   pIn - Pointer to audio buffer containing samples
-void cUIVuMeterView::Process(AudioBuffer *pIn) {
+void cUIVuMeterView::Process(const AudioBuffer *pIn) {
 	ProcessSample(pIn->Left, &m_MeterLeft, &m_CtPeakLeft);
 	ProcessSample(pIn->Right, &m_MeterRight, &m_CtPeakRight);
 }
 
+// ------------------------------------------------------------------------------
+// Function: Process
+// Description: Processes a block of audio frames to update meter values
+// Parameters:
+//   In - Block of audio frames
+void cUIVuMeterView::Process(const AudioBlock &In) {
+	for(size_t Index = 0; Index < In.Size; Index++) {
+		ProcessSample(In.L(Index), &m_MeterLeft, &m_CtPeakLeft);
+		ProcessSample(In.R(Index), &m_MeterRight, &m_CtPeakRight);
+	}
+}
+
 // ------------------------------------------------------------------------------
 // Function: OnMainFocusLost
 // Description: Called when this view loses focus
@@ -169,7 +182,7 @@ void cUIVuMeterView::OnMainFocusGained(){
 //   sample - Audio sample value to convert
 // Returns: Pixel width corresponding to the sample's dB level
 uint16_t cUIVuMeterView::SampleToDbPixel(float sample) {
-	float db = 20.0f * log10f(fabs(sample) + 1e-6f);  // Convert to dB with small offset to avoid log(0)
+	float db = DadDSP::LinearToDb(fabs(sample) + 1e-6f);  // Convert to dB with small offset to avoid log(0)
 	if (db < MIN_DB) db = MIN_DB;  // Clamp to minimum dB
 	if (db > 0) db = 0;            // Clamp to 0dB
 	return static_cast<uint16_t>((((db - MIN_DB) / -MIN_DB) * VU_WIDTH) + 0.5f);  // Scale to pixel width
@@ -207,6 +220,155 @@ void cUIVuMeterView::ProcessSample(float sample, float *pMeter, int32_t *pPeak)
 	}
 }
 
+//***********************************************************************************
+// class cUIResponseView
+// Description: Draws the frequency response curve of a filter (EQ)
+//***********************************************************************************
+
+// ------------------------------------------------------------------------------
+// Function: Init
+// Description: Initializes the frequency scale and the response callback
+void cUIResponseView::Init(tResponseCallback Callback, uintptr_t CallbackUserData, float MinFreq, float MaxFreq, float RangeDb) {
+	m_Callback = Callback;
+	m_CallbackUserData = CallbackUserData;
+	m_MinFreq = MinFreq;
+	m_MaxFreq = MaxFreq;
+	m_RangeDb = RangeDb;
+
+	// Log spaced frequencies, one per curve point
+	float Ratio = powf(MaxFreq / MinFreq, 1.0f / (RESPONSE_POINTS - 1));
+	float Freq = MinFreq;
+	for(uint16_t Point = 0; Point < RESPONSE_POINTS; Point++) {
+		m_Freq[Point] = Freq;
+		m_GainDb[Point] = 0.0f;
+		Freq *= Ratio;
+	}
+	m_Dirty = true;
+}
+
+// ------------------------------------------------------------------------------
+// Function: Draw
+// Description: Evaluates and redraws the curve if the response has changed
+void cUIResponseView::Draw() {
+	if(!m_Dirty) {
+		return;
+	}
+	m_Dirty = false;
+	m_Callback(m_Freq, m_GainDb, RESPONSE_POINTS, m_CallbackUserData);
+
+	cPendaUI::m_pDynMainDownLayer->eraseLayer();
+	uint16_t LastX = RESPONSE_X;
+	uint16_t LastY = GainToY(m_GainDb[0]);
+	for(uint16_t Point = 1; Point < RESPONSE_POINTS; Point++) {
+		uint16_t X = RESPONSE_X + ((Point * (RESPONSE_WIDTH - 1)) / (RESPONSE_POINTS - 1));
+		uint16_t Y = GainToY(m_GainDb[Point]);
+		cPendaUI::m_pDynMainDownLayer->drawLine(LastX, LastY, X, Y, LAYER_POT_INDEX_COLOR);
+		cPendaUI::m_pDynMainDownLayer->drawLine(LastX, LastY + 1, X, Y + 1, LAYER_POT_INDEX_COLOR);
+		LastX = X;
+		LastY = Y;
+	}
+}
+
+// ------------------------------------------------------------------------------
+// Function: OnMainFocusLost
+// Description: Called when this view loses focus
+void cUIResponseView::OnMainFocusLost(){
+	cPendaUI::m_pStatMainDownLayer->changeZOrder(0);
+	cPendaUI::m_pDynMainDownLayer->changeZOrder(0);
+}
+
+// ------------------------------------------------------------------------------
+// Function: drawMainDownStat
+// Description: Draws the static elements of the view (frame and grid)
+void cUIResponseView::drawMainDownStat() {
+	cPendaUI::m_pStatMainDownLayer->eraseLayer(MENU_BACK_COLOR);
+	cPendaUI::m_pStatMainDownLayer->drawFillRect(RESPONSE_X, RESPONSE_Y, RESPONSE_WIDTH, RESPONSE_HEIGHT, DadGFX::sColor(45, 64, 59));
+	cPendaUI::m_pStatMainDownLayer->drawRect(RESPONSE_X - 2, RESPONSE_Y - 2, RESPONSE_WIDTH + 4, RESPONSE_HEIGHT + 4, 2, DadGFX::sColor(200,200,200));
+
+	// Decades and gain lines (0 dB and half range)
+	const DadGFX::sColor GridColor(70, 100, 92);
+	for(float Freq = 100.0f; Freq < m_MaxFreq; Freq *= 10.0f) {
+		if(Freq > m_MinFreq) {
+			uint16_t X = FreqToX(Freq);
+			cPendaUI::m_pStatMainDownLayer->drawLine(X, RESPONSE_Y, X, RESPONSE_Y + RESPONSE_HEIGHT - 1, GridColor);
+		}
+	}
+	cPendaUI::m_pStatMainDownLayer->drawLine(RESPONSE_X, GainToY(m_RangeDb / 2), RESPONSE_X + RESPONSE_WIDTH - 1, GainToY(m_RangeDb / 2), GridColor);
+	cPendaUI::m_pStatMainDownLayer->drawLine(RESPONSE_X, GainToY(-m_RangeDb / 2), RESPONSE_X + RESPONSE_WIDTH - 1, GainToY(-m_RangeDb / 2), GridColor);
+	cPendaUI::m_pStatMainDownLayer->drawLine(RESPONSE_X, GainToY(0.0f), RESPONSE_X + RESPONSE_WIDTH - 1, GainToY(0.0f), DadGFX::sColor(120, 150, 140));
+}
+
+// ------------------------------------------------------------------------------
+// Function: OnMainFocusGained
+// Description: Called when this view gains focus
+void cUIResponseView::OnMainFocusGained(){
+	cPendaUI::m_pStatMainDownLayer->changeZOrder(40);
+	cPendaUI::m_pDynMainDownLayer->changeZOrder(41);
+	drawMainDownStat();
+	m_Dirty = true;
+	Draw();
+}
+
+// ------------------------------------------------------------------------------
+// Function: FreqToX
+// Description: Converts a frequency to a horizontal pixel position
+uint16_t cUIResponseView::FreqToX(float Freq) {
+	float Position = logf(Freq / m_MinFreq) / logf(m_MaxFreq / m_MinFreq);
+	return RESPONSE_X + static_cast<uint16_t>(Position * (RESPONSE_WIDTH - 1) + 0.5f);
+}
+
+// ------------------------------------------------------------------------------
+// Function: GainToY
+// Description: Converts a gain to a vertical pixel position (clamped to the area)
+uint16_t cUIResponseView::GainToY(float GainDb) {
+	if (GainDb > m_RangeDb) GainDb = m_RangeDb;
+	if (GainDb < -m_RangeDb) GainDb = -m_RangeDb;
+	float Position = (m_RangeDb - GainDb) / (2.0f * m_RangeDb);			// 0 top, 1 bottom
+	return RESPONSE_Y + static_cast<uint16_t>(Position * (RESPONSE_HEIGHT - 2) + 0.5f);
+}
+
+//***********************************************************************************
+// class cUIResponseParameters
+// Description: Parameter page showing a frequency response curve in the main view
+//***********************************************************************************
+
+// ------------------------------------------------------------------------------
+// Function: Init
+// Description: Initializes the parameter views and the (shared) response view
+void cUIResponseParameters::Init(cParameterView* paramView1, cParameterView* paramView2, cParameterView* paramView3,
+                                 cUIResponseView *pResponseView){
+	m_pResponseView = pResponseView;
+	cUIParameters::Init(paramView1, paramView2, paramView3);
+}
+
+// ------------------------------------------------------------------------------
+// Function: Activate
+// Description: Activates the page and requests focus for the response view
+void cUIResponseParameters::Activate(){
+	cPendaUI::RequestFocus(m_pResponseView);
+	cUIParameters::Activate();
+}
+
+// ------------------------------------------------------------------------------
+// Function: DeActivate
+// Description: Deactivates the page and releases focus
+void cUIResponseParameters::DeActivate(){
+	cUIParameters::DeActivate();
+	if((m_pResponseView != nullptr) && cPendaUI::HasFocus(m_pResponseView)) {
+		cPendaUI::ReleaseFocus();
+	}
+}
+
+// ------------------------------------------------------------------------------
+// Function: Update
+// Description: Updates the page and redraws the response if it has changed
+void cUIResponseParameters::Update(){
+	cUIParameters::Update();
+	if(cPendaUI::HasFocus(m_pResponseView)) {
+		m_pResponseView->Draw();
+	}
+}
+
 //***********************************************************************************
 // class cUIImputVolume
 // Description: Implements the input volume control UI with VU meters
@@ -217,8 +379,8 @@ void cUIVuMeterView::ProcessSample(float sample, float *pMeter, int32_t *pPeak)
 // Description: Initializes the UI components and parameters
 void cUIImputVolume::Init(){
 	// Initialize parameters with ranges and callbacks
-	m_InputVolume.Init(50.0f, 0.0f, 100.0f, 10.0f, 1.0f, VolumePanChange, (uint32_t) this, 0.0f, 0, SysSerializeID);
-	m_InputPanning.Init(0.0f, -100.0f, +100.0f, 5.0f, 1.0f, VolumePanChange, (uint32_t) this, 0.0f, 0, SysSerializeID);
+	m_InputVolume.Init(50.0f, 0.0f, 100.0f, 10.0f, 1.0f, VolumePanChange, (uintptr_t) this, 0.0f, 0, SysSerializeID);
+	m_InputPanning.Init(0.0f, -100.0f, +100.0f, 5.0f, 1.0f, VolumePanChange, (uintptr_t) this, 0.0f, 0, SysSerializeID);
 	// Restore value for input volume and panning
 
 	uint32_t Size = __PersistentStorage.getSize(SysSerializeID);	  		// Get the size of the data
@@ -239,16 +401,63 @@ void cUIImputVolume::Init(){
 	m_InputVolumeView.Init(&m_InputVolume, "Input Vol.", "Input Volume", "%", "%");
 	m_InputPanningView.Init(&m_InputPanning, "Pan", "Input Panning", "%", "%");
 
+	// Audio block size: the active size is read at boot (LoadAudioBufferSize),
+	// a new value is saved on DeActivate and applied at the next boot.
+	m_BlockSize.Init(0.0f, 0.0f, 0.0f, 1.0f, 1.0f, nullptr, 0, 0.0f, 0xFF, AudioSerializeID);
+	m_BlockSizeView.Init(&m_BlockSize, "Block", "Block (reboot)");
+	m_BlockSizeView.AddDiscreteValue("4", "4 frames");
+	m_BlockSizeView.AddDiscreteValue("8", "8 frames");
+	m_BlockSizeView.AddDiscreteValue("16", "16 frames");
+	m_BlockSizeView.AddDiscreteValue("32", "32 frames");
+	m_BlockSizeView.AddDiscreteValue("64", "64 frames");
+	uint32_t BlockSizeIndex = 0;
+	while((BlockSizeIndexToFrames(BlockSizeIndex) < AUDIO_BUFFER_SIZE) &&
+		  (BlockSizeIndexToFrames(BlockSizeIndex) < AUDIO_BUFFER_SIZE_MAX)) {
+		BlockSizeIndex++;
+	}
+	m_BlockSize.setValue(static_cast<float>(BlockSizeIndex));
+	m_MemBlockSize = m_BlockSize;
+
 	// Initialize VU meter
 	m_UIVuMeterView.Init();
 #ifdef PENDAI
-	cUIParameters::Init(nullptr, nullptr, nullptr);
+	cUIParameters::Init(nullptr, &m_BlockSizeView, nullptr);
 #elif defined(PENDAII)
 	// Initialize base class with parameter views
-	cUIParameters::Init(&m_InputVolumeView, nullptr, &m_InputPanningView);
+	cUIParameters::Init(&m_InputVolumeView, &m_BlockSizeView, &m_InputPanningView);
 #endif
 }
 
+// ------------------------------------------------------------------------------
+// Static Function: LoadAudioBufferSize
+// Description: Reads the audio block size setting from persistent storage.
+//              Called at boot, before the UI and the effect are initialized.
+// Returns: Block size in frames (AUDIO_BUFFER_SIZE_DEFAULT if not saved)
+uint32_t cUIImputVolume::LoadAudioBufferSize() {
+	uint32_t BlockSize = AUDIO_BUFFER_SIZE_DEFAULT;
+	uint32_t Size = __PersistentStorage.getSize(AudioSerializeID);			// Get the size of the data
+	if (Size >= sizeof(float)) {
+		uint8_t* pBuffer = new uint8_t[Size]; 								// Allocate memory for the data
+		if (pBuffer != nullptr) {
+			uint32_t SizeLoad=0;
+			__PersistentStorage.Load(AudioSerializeID, pBuffer, Size, SizeLoad); // Load data
+			if(SizeLoad >= sizeof(float)){
+				DadQSPI::cSerialize Serializer; 							// Same format as cParameter::Save
+				Serializer.setBuffer(pBuffer, Size);
+				float Index;
+				Serializer.Pull(Index);
+				// Integer index in [0, BLOCK_SIZE_INDEX_MAX] only (NaN fails the comparisons)
+				if((Index >= 0.0f) && (Index <= static_cast<float>(BLOCK_SIZE_INDEX_MAX)) &&
+				   (Index == static_cast<float>(static_cast<uint32_t>(Index)))) {
+					BlockSize = BlockSizeIndexToFrames(static_cast<uint32_t>(Index));
+				}
+			}
+			delete[] pBuffer; 												// Free the allocated memory
+		}
+	}
+	return BlockSize;
+}
+
 // ------------------------------------------------------------------------------
 // Function: Activate
 // Description: Activates the UI and requests focus for the VU meter
@@ -273,6 +482,16 @@ void cUIImputVolume::DeActivate(){
 		m_MemInputPanning = m_InputPanning;
 	}
 
+	// Save the audio block size if it has changed (applied at next boot)
+	if(m_BlockSize != m_MemBlockSize) {
+		DadQSPI::cSerialize Serializer;
+		cPendaUI::Save(Serializer, AudioSerializeID);
+		const uint8_t* pBuffer = nullptr;
+		uint32_t Size = Serializer.getBuffer(&pBuffer);
+		__PersistentStorage.Save(AudioSerializeID, pBuffer, Size);
+		m_MemBlockSize = m_BlockSize;
+	}
+
 	cUIParameters::DeActivate();
 	if(cPendaUI::HasFocus(&m_UIVuMeterView)) {
 		cPendaUI::ReleaseFocus();
@@ -295,7 +514,7 @@ void cUIImputVolume::Update(){
 // Parameters:
 //   pParameter - The changed parameter
 //   CallbackUserData - Pointer to this instance
-void cUIImputVolume::VolumePanChange(DadUI::cParameter *pParameter, uint32_t CallbackUserData) {
+void cUIImputVolume::VolumePanChange(DadUI::cParameter *pParameter, uintptr_t CallbackUserData) {
 	cUIImputVolume* pThis = (cUIImputVolume*)CallbackUserData;
 	float Pan = pThis->m_InputPanning.getNormalizedValue();
 	float Vol = pThis->m_InputVolume.getNormalizedValue();
@@ -9,6 +9,9 @@
 #define PENDA_DELAY
 //#define PENDA_TREMOLO
 //#define PENDA_TEMPLATE
+//#define PENDA_EQ
+//#define PENDA_CHAIN
+//#define PENDA_REGISTRY
 
 // Configuring the PENDA Delay
 #ifdef PENDA_DELAY
@@ -33,3 +36,27 @@
 #define EFFECT_NAME "Template"
 #define EFFECT_VERSION "Version 1.0"
 #endif
+
+// Configuring the PENDA parametric EQ
+#ifdef PENDA_EQ
+#include "ParametricEQ.h"
+#define EFFECT DadEffect::cParametricEQ
+#define EFFECT_NAME "EQ"
+#define EFFECT_VERSION "Version 1.0"
+#endif
+
+// Configuring the PENDA Tremolo -> Delay chain
+#ifdef PENDA_CHAIN
+#include "TremoloDelay.h"
+#define EFFECT DadEffect::cTremoloDelay
+#define EFFECT_NAME "Trem>Delay"
+#define EFFECT_VERSION "Version 1.0"
+#endif
+
+// Configuring the PENDA hot-swappable Delay / Tremolo
+#ifdef PENDA_REGISTRY
+#include "MultiEffect.h"
+#define EFFECT DadEffect::cMultiEffect
+#define EFFECT_NAME "Multi FX"
+#define EFFECT_VERSION "Version 1.0"
+#endif
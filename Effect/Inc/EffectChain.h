@@ -0,0 +1,144 @@
+#pragma once
+//====================================================================================
+// EffectChain.h
+//
+// Runtime host running several effects in series on one pedal.
+//
+//   In -> [Slot 0] -> [Slot 1] -> ... -> [Slot n-1] -> Out
+//
+// Each slot has its own On/Off (bypass) and digital dry/wet mix, crossfaded over
+// one block. A bypassed slot stops feeding its effect but keeps mixing in the
+// effect output (delay tail) until it has been silent for the tail time of the
+// effect, so the effect holds no stale audio when it is switched on again.
+// The output level against the analog dry path is set by the global Mix
+// through cVolume, as for a single effect. Intermediate blocks are kept in
+// DTCM so the chain adds no SDRAM traffic.
+//
+// Copyright(c) 2025 Dad Design.
+//====================================================================================
+#include "main.h"
+#include "AudioBlock.h"
+#include "PendaUI.h"
+#include "UIComponent.h"
+#include "Parameter.h"
+#include "UISystem.h"
+#include "cMonitor.h"
+#include "EffectInterface.h"
+
+namespace DadEffect {
+
+constexpr uint8_t CHAIN_MAX_SLOTS = 3;		// Maximum number of effects in a chain
+constexpr float CHAIN_TAIL_FLOOR = 1e-5f;	// Peak below which a bypassed effect is silent (-100 dBFS)
+
+// MIDI assignment
+// Effect parameters of slot n use 10 CCs from __ChainSlotMidiCC[n] (see EffectChain.cpp)
+#define CHAIN_MIDI_SLOT_ONOFF	14		// CC#14 + 2*slot : slot On/Off
+#define CHAIN_MIDI_SLOT_MIX		15		// CC#15 + 2*slot : slot Mix
+#define CHAIN_MIDI_MIX			22		// CC#22 : global Mix
+
+//***********************************************************************************
+//  cEffectChainHost
+//
+//  Usage (in the Initialize() of a derived class owning the effects):
+//      InitChain(SerializeID);
+//      addSlot(&m_Effect1, "Eff1", "Effect 1");
+//      addSlot(&m_Effect2, "Eff2", "Effect 2", true);   // true : tap tempo target
+//      StartChain();
+//***********************************************************************************
+class cEffectChainHost {
+public:
+	// --------------------------------------------------------------------------
+	// Constructor (initializes nothing by itself).
+	cEffectChainHost() {};
+
+	// --------------------------------------------------------------------------
+	// Audio processing function: runs the slots in series on a block of frames.
+	ITCM void Process(const AudioBlock &In, const AudioBlock &Out);
+
+	// --------------------------------------------------------------------------
+	// Number of slots
+	inline uint8_t getNbSlots() const { return m_NbSlots; }
+
+#ifdef MONITOR
+	// --------------------------------------------------------------------------
+	// Execution time monitor of a slot
+	inline DadMisc::cMonitor &getSlotMonitor(uint8_t Slot) { return m_Slots[Slot].Monitor; }
+#endif
+
+	// --------------------------------------------------------------------------
+	// UI Callbacks
+	static void MixChange(DadUI::cParameter *pParameter, uintptr_t CallbackUserData);
+
+protected:
+	// --------------------------------------------------------------------------
+	// Prepares an empty chain
+	void InitChain(uint32_t SerializeID);
+
+	// --------------------------------------------------------------------------
+	// Appends an effect to the chain and initializes it for the slot.
+	// Returns false if the chain is full.
+	bool addSlot(iEffect *pEffect, const char *ShortName, const char *LongName, bool TapTempo = false);
+
+	// --------------------------------------------------------------------------
+	// Builds the menu (slot pages, effect pages, memory, input) and activates it
+	void StartChain();
+
+	// --------------------------------------------------------------------------
+	// Copies In to Send with a gain ramped over the block
+	static void SendBlock(const AudioBlock &In, const AudioBlock &Send, float GainStart, float GainEnd);
+
+	// --------------------------------------------------------------------------
+	// Peak level of a block
+	static float PeakBlock(const AudioBlock &Block);
+
+	// --------------------------------------------------------------------------
+	// Mixes the dry block into the wet block with gains ramped over the block
+	// (Dry and Wet may not share storage)
+	static void MixBlock(const AudioBlock &Dry, const AudioBlock &Wet,
+	                     float DryStart, float DryEnd, float WetStart, float WetEnd);
+
+	// ==============================================================================
+	// Slots
+	// ==============================================================================
+	struct sChainSlot {
+		iEffect*						pEffect;
+		const char*						ShortName;		// Menu tab name
+
+		DadUI::cParameter				OnOff;			// Slot bypass
+		DadUI::cParameter				Mix;			// Slot dry/wet
+
+		DadUI::cParameterDiscretView	OnOffView;
+		DadUI::cParameterNumNormalView	MixView;
+		DadUI::cUIParameters			ItemSlotMenu;
+
+		float							DryGain;		// Gains applied at the end of the last block
+		float							WetGain;
+		float							SendGain;		// Effect input gain at the end of the last block
+		uint32_t						TailFrames;		// Tail time of the effect (frames)
+		uint32_t						SilentFrames;	// Silent output since the input was cut
+		bool							Tail;			// Effect output may not be silent yet
+#ifdef MONITOR
+		DadMisc::cMonitor				Monitor;		// Slot execution time
+#endif
+	};
+
+	sChainSlot		m_Slots[CHAIN_MAX_SLOTS];
+	uint8_t			m_NbSlots = 0;
+	int8_t			m_TapTempoSlot = -1;
+	uint32_t		m_SerializeID = 0;
+
+	// ==============================================================================
+	// Chain User Interface
+	// ==============================================================================
+	DadUI::cParameter				m_Mix;				// Global mix (cVolume)
+	DadUI::cParameterNumNormalView	m_MixView;
+	DadUI::cUIParameters			m_ItemChainMenu;
+	DadUI::cUIMemory				m_ItemMenuMemory;	// Persistent parameter storage
+	DadUI::cUIImputVolume			m_ItemInputVolume;	// Input volume menu
+	DadUI::cUIMenu					m_Menu;
+	DadUI::cTapTempo				m_TapTempo;
+
+	float							m_GainWet = 0.0f;	// Output gain from the global mix
+};
+
+} // namespace DadEffect
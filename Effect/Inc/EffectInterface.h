@@ -0,0 +1,67 @@
+#pragma once
+//====================================================================================
+// EffectInterface.h
+//
+// Interface implemented by the effects that can run in a slot of an effect chain
+// or be selected in the effect registry.
+// A standalone effect builds its whole user interface in Initialize(); a chained
+// effect only builds its DSP and parameters, the chain owns the menu, memory,
+// input volume and dry/wet.
+//
+// Effect buffers are allocated from __EffectArena (SDRAM) during initialization.
+// The arena is reset when the registry replaces the running effect.
+//
+// Copyright(c) 2025 Dad Design.
+//====================================================================================
+#include "main.h"
+#include "AudioBlock.h"
+#include "UIComponent.h"
+#include "cArena.h"
+
+// SDRAM arena of the effect buffers (defined in main.cpp)
+extern DadMisc::cArena __EffectArena;
+
+namespace DadEffect {
+
+//***********************************************************************************
+//  iEffect
+//***********************************************************************************
+class iEffect {
+public:
+	virtual ~iEffect() {}
+
+	// --------------------------------------------------------------------------
+	// Initializes the effect as the single effect of the pedal
+	// (DSP, parameters, menu, memory and input volume).
+	virtual void Initialize() = 0;
+
+	// --------------------------------------------------------------------------
+	// Main menu built by Initialize() (nullptr if none).
+	virtual DadUI::cUIMenu *getMenu() { return nullptr; }
+
+	// --------------------------------------------------------------------------
+	// Initializes DSP modules and parameters for use in a chain slot.
+	// SerializeID : ID of the chain presets the parameters are saved with
+	// MidiCCBase  : first MIDI CC of the effect parameters
+	virtual void InitializeSlot(uint32_t SerializeID, uint8_t MidiCCBase) = 0;
+
+	// --------------------------------------------------------------------------
+	// Adds the effect parameter pages to a menu.
+	virtual void AddMenuItems(DadUI::cUIMenu &Menu) = 0;
+
+	// --------------------------------------------------------------------------
+	// Connects a tap tempo controller to the effect tempo parameter (if any).
+	virtual void InitTapTempo(DadUI::cTapTempo &TapTempo) {}
+
+	// --------------------------------------------------------------------------
+	// Longest time (s) the output can stay silent while the effect still holds
+	// audio (e.g. the delay before the next repeat). 0 if the output follows
+	// the input.
+	virtual float getTailTime() const { return 0.0f; }
+
+	// --------------------------------------------------------------------------
+	// Processes a block of audio frames (In and Out never share storage).
+	virtual void Process(const AudioBlock &In, const AudioBlock &Out) = 0;
+};
+
+} // namespace DadEffect
@@ -0,0 +1,153 @@
+#pragma once
+//====================================================================================
+// EffectRegistry.h
+//
+// Hot-swappable effect: several effects are registered, only the selected one is
+// instantiated and run. The selection is made on the "FX" page (applied once the
+// choice is stable) or by a MIDI Program Change (applied at once).
+//
+// The running effect and its buffers live in the SDRAM effect arena. On a switch:
+//   - the output fades out and stays muted (audio thread),
+//   - the effect is destroyed and the arena reset (main loop),
+//   - the new effect is created and initialized as a standalone effect,
+//   - the output fades in.
+// SDRAM usage is the one of the largest effect, not the sum of all effects.
+//
+// Copyright(c) 2025 Dad Design.
+//====================================================================================
+#include "main.h"
+#include "AudioBlock.h"
+#include "PendaUI.h"
+#include "UIComponent.h"
+#include "Parameter.h"
+#include "EffectInterface.h"
+#include <new>
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmultichar"
+constexpr uint32_t RegistrySerializeID = 'Reg0';	// SerializeID of the selected effect
+#pragma GCC diagnostic pop
+
+namespace DadEffect {
+
+constexpr uint8_t  REGISTRY_MAX_EFFECTS = 8;		// Maximum number of registered effects
+constexpr uint32_t REGISTRY_SELECT_DELAY = 500;		// UI selection applied after 500 ms without change
+constexpr float    REGISTRY_FADE_TIME = 0.005f;		// Fade out/in time in seconds
+
+// MIDI assignment
+// Program Change 0..9 load the presets of the running effect (cUIMemory)
+#define REGISTRY_MIDI_PC_BASE	100		// PC#100 + n : selects effect n
+
+// Creates an effect in the arena
+using tEffectFactory = iEffect *(*)(DadMisc::cArena &Arena);
+
+//***********************************************************************************
+//  cEffectRegistry
+//
+//  Usage (in the Initialize() of a derived class):
+//      InitRegistry();
+//      addEffect<cEffect1>("Eff1", "Effect 1");
+//      addEffect<cEffect2>("Eff2", "Effect 2");
+//      StartRegistry();
+//  and Update() called from the main loop.
+//***********************************************************************************
+class cEffectRegistry {
+public:
+	// --------------------------------------------------------------------------
+	// Constructor (initializes nothing by itself).
+	cEffectRegistry() {};
+
+	// --------------------------------------------------------------------------
+	// Audio processing function: runs the selected effect and the switch fades.
+	ITCM void Process(const AudioBlock &In, const AudioBlock &Out);
+
+	// --------------------------------------------------------------------------
+	// Main loop processing: applies a pending selection.
+	// Must not be called from a GUI object (the user interface is rebuilt).
+	void Update();
+
+	// --------------------------------------------------------------------------
+	// Number of registered effects / selected effect
+	inline uint8_t getNbEffects() const { return m_NbEffects; }
+	inline uint8_t getCurrentEffect() const { return m_Current; }
+
+	// --------------------------------------------------------------------------
+	// MIDI Callback
+	static void MIDI_ProgramChange_CallBack(uint8_t program, uintptr_t userData);
+
+protected:
+	// --------------------------------------------------------------------------
+	// Prepares an empty registry
+	void InitRegistry();
+
+	// --------------------------------------------------------------------------
+	// Registers an effect. Returns false if the registry is full.
+	bool addEffect(const char *ShortName, const char *LongName, tEffectFactory Factory);
+
+	template<typename tEffect>
+	inline bool addEffect(const char *ShortName, const char *LongName) {
+		return addEffect(ShortName, LongName, Create<tEffect>);
+	}
+
+	// --------------------------------------------------------------------------
+	// Restores the last selected effect and starts it
+	void StartRegistry();
+
+	// --------------------------------------------------------------------------
+	// Factory of an effect type (placement new in the arena)
+	template<typename tEffect>
+	static iEffect *Create(DadMisc::cArena &Arena) {
+		void *pMemory = Arena.Allocate(sizeof(tEffect), alignof(tEffect));
+		return new (pMemory) tEffect();
+	}
+
+	// --------------------------------------------------------------------------
+	// Replaces the running effect by m_Pending (output muted)
+	void SwapEffect();
+
+	// --------------------------------------------------------------------------
+	// Creates and initializes the effect m_Pending
+	void StartEffect();
+
+	// ==============================================================================
+	// Registered effects
+	// ==============================================================================
+	struct sEffectEntry {
+		const char*		ShortName;
+		const char*		LongName;
+		tEffectFactory	Factory;
+	};
+
+	sEffectEntry		m_Effects[REGISTRY_MAX_EFFECTS];
+	uint8_t				m_NbEffects = 0;
+
+	// ==============================================================================
+	// Switch state
+	// ==============================================================================
+	// Running -> FadeOut -> Muted (swap in the main loop) -> FadeIn -> Running
+	enum class eSwapState : uint8_t {
+		Running,
+		FadeOut,
+		Muted,
+		FadeIn
+	};
+
+	iEffect* volatile	m_pEffect = nullptr;			// Running effect (in the arena)
+	volatile eSwapState	m_State = eSwapState::Muted;
+	float				m_FadeGain = 0.0f;				// Current fade gain
+	float				m_FadeStep = 0.0f;				// Fade gain increment per frame
+
+	uint8_t				m_Current = 0;					// Running effect
+	uint8_t				m_Pending = 0;					// Last selection
+	uint32_t			m_PendingTime = 0;				// Time of the last selection (ms)
+	volatile int8_t		m_MidiRequest = -1;				// Effect selected by MIDI (-1 : none)
+
+	// ==============================================================================
+	// Registry User Interface
+	// ==============================================================================
+	DadUI::cParameter				m_Select;			// Selected effect
+	DadUI::cParameterDiscretView	m_SelectView;
+	DadUI::cUIParameters			m_ItemSelectMenu;	// "FX" page added to the effect menu
+};
+
+} // namespace DadEffect
@@ -8,10 +8,12 @@
 // Copyright (c) 2025 Dad Design.
 //====================================================================================
 #include "main.h"
+#include "AudioBlock.h"
 #include "PendaUI.h"
 #include "UIComponent.h"
 #include "Parameter.h"
 #include "UISystem.h"
+#include "EffectInterface.h"
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wmultichar"
@@ -27,7 +29,7 @@ namespace DadEffect {
 //  Base class for an audio effect on the PENDA platform.
 //  Contains essential parameters, user interface elements, and audio processing.
 //***********************************************************************************
-class cEffectTemplate {
+class cEffectTemplate : public iEffect {
 public:
 	// --------------------------------------------------------------------------
 	// Constructor
@@ -35,18 +37,47 @@ public:
 
 	// --------------------------------------------------------------------------
 	// Initializes DSP modules and UI parameters.
-	virtual void Initialize();
+	void Initialize() override;
 
 	// --------------------------------------------------------------------------
-	// Audio processing function.
+	// Initializes DSP modules and parameters for an effect chain slot.
+	void InitializeSlot(uint32_t SerializeID, uint8_t MidiCCBase) override;
+
+	// --------------------------------------------------------------------------
+	// Main menu (standalone).
+	DadUI::cUIMenu *getMenu() override { return &m_Menu; }
+
+	// --------------------------------------------------------------------------
+	// Adds the effect parameter pages to a menu.
+	void AddMenuItems(DadUI::cUIMenu &Menu) override;
+
+	// --------------------------------------------------------------------------
+	// Audio processing function (block of audio frames).
 	// Must be completed to implement a specific effect.
-	virtual ITCM void Process(AudioBuffer *pIn, AudioBuffer *pOut, bool OnOff);
+	ITCM void Process(const AudioBlock &In, const AudioBlock &Out) override;
+
+	// --------------------------------------------------------------------------
+	// Block processing on interleaved frames (zero-copy adapter).
+	inline void Process(const AudioBuffer *pIn, AudioBuffer *pOut, size_t nFrames){
+		Process(AudioBlock::Interleaved(pIn, nFrames), AudioBlock::Interleaved(pOut, nFrames));
+	}
+
+	// --------------------------------------------------------------------------
+	// Per-sample processing (compatibility adapter over the block path).
+	inline void ProcessSample(const AudioBuffer *pIn, AudioBuffer *pOut){
+		Process(pIn, pOut, 1);
+	}
 
 	// --------------------------------------------------------------------------
 	// UI callback for the Dry/Wet mix parameter
-	static void MixChange(DadUI::cParameter *pParameter, uint32_t CallbackUserData);
+	static void MixChange(DadUI::cParameter *pParameter, uintptr_t CallbackUserData);
 
 protected:
+	// --------------------------------------------------------------------------
+	// Initializes DSP modules, parameters, views and parameter groups.
+	// WithMix : the effect has its own dry/wet parameter (standalone)
+	void InitializeEffect(uint32_t SerializeID, uint8_t MidiCCBase, bool WithMix);
+
 	// ==============================================================================
 	// User Parameters (UI)
 	// ==============================================================================
@@ -70,6 +101,7 @@ protected:
 	// ==============================================================================
 
 	float m_GainWet;
+	bool  m_InputMeter = false;	// Feed the input VU-meter (standalone)
 };
 
 } // namespace DadEffect
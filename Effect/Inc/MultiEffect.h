@@ -0,0 +1,33 @@
+#pragma once
+//====================================================================================
+// MultiEffect.h
+//
+// Delay / Tremolo / EQ selectable on the "FX" page or by MIDI Program Change.
+//
+// Copyright(c) 2025 Dad Design.
+//====================================================================================
+#include "EffectRegistry.h"
+#include "Delay.h"
+#include "Tremolo.h"
+#include "ParametricEQ.h"
+
+namespace DadEffect {
+
+//***********************************************************************************
+//  cMultiEffect
+//
+//  One effect at a time, each with its own presets, mix and input volume.
+//  PC#100 selects the Delay, PC#101 the Tremolo, PC#102 the EQ.
+//***********************************************************************************
+class cMultiEffect : public cEffectRegistry {
+public:
+	// --------------------------------------------------------------------------
+	// Constructor (initializes nothing by itself).
+	cMultiEffect() {};
+
+	// --------------------------------------------------------------------------
+	// Registers the effects and starts the last selected one.
+	void Initialize();
+};
+
+} // namespace DadEffect
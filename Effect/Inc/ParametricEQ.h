@@ -0,0 +1,139 @@
+#pragma once
+//====================================================================================
+// ParametricEQ.h
+//
+// Declaration of the parametric EQ effect class.
+// Five bands (low shelf, three peaking bands, high shelf) between a low cut and
+// a high cut filter, processed as one cascade of second order sections.
+//
+// Copyright (c) 2025 Dad Design.
+//====================================================================================
+#include "main.h"
+#include "AudioBlock.h"
+#include "PendaUI.h"
+#include "UIComponent.h"
+#include "Parameter.h"
+#include "BiquadFilter.h"
+#include "UISystem.h"
+#include "EffectInterface.h"
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmultichar"
+constexpr uint32_t ParametricEQSerializeID = 'PEq0'; // SerializeID for EQ Effect
+#pragma GCC diagnostic pop
+
+namespace DadEffect {
+
+constexpr uint8_t EQ_NB_MID_BANDS = 3;		// Peaking bands between the shelves
+
+//***********************************************************************************
+//  cParametricEQ
+//
+//  Main class for the parametric EQ effect.
+//  Sections of the cascade: low cut (HPF), low shelf, 3 x peaking, high shelf,
+//  high cut (LPF). Every EQ page shows the response curve of the cascade.
+//***********************************************************************************
+class cParametricEQ : public iEffect {
+public:
+	// --------------------------------------------------------------------------
+	// Constructor
+	// Note: Does not perform any initialization. Call Initialize() explicitly.
+	cParametricEQ() {};
+
+	// --------------------------------------------------------------------------
+	// Initializes DSP modules and UI parameters.
+	void Initialize() override;
+
+	// --------------------------------------------------------------------------
+	// Initializes DSP modules and parameters for an effect chain slot.
+	void InitializeSlot(uint32_t SerializeID, uint8_t MidiCCBase) override;
+
+	// --------------------------------------------------------------------------
+	// Main menu (standalone).
+	DadUI::cUIMenu *getMenu() override { return &m_Menu; }
+
+	// --------------------------------------------------------------------------
+	// Adds the EQ parameter pages to a menu.
+	void AddMenuItems(DadUI::cUIMenu &Menu) override;
+
+	// --------------------------------------------------------------------------
+	// Audio processing function: filters a block of audio frames.
+	ITCM void Process(const AudioBlock &In, const AudioBlock &Out) override;
+
+	// --------------------------------------------------------------------------
+	// Block processing on interleaved frames (zero-copy adapter).
+	inline void Process(const AudioBuffer *pIn, AudioBuffer *pOut, size_t nFrames){
+		Process(AudioBlock::Interleaved(pIn, nFrames), AudioBlock::Interleaved(pOut, nFrames));
+	}
+
+	// --------------------------------------------------------------------------
+	// Per-sample processing (compatibility adapter over the block path).
+	inline void ProcessSample(const AudioBuffer *pIn, AudioBuffer *pOut){
+		Process(pIn, pOut, 1);
+	}
+
+	// --------------------------------------------------------------------------
+	// UI Callbacks
+	static void EQChange(DadUI::cParameter *pParameter, uintptr_t CallbackUserData);
+	static void MixChange(DadUI::cParameter *pParameter, uintptr_t CallbackUserData);
+
+	// --------------------------------------------------------------------------
+	// Response curve callback (batch evaluation of the cascade gain)
+	static void ResponseCallback(const float *pFreq, float *pGainDb, size_t Count, uintptr_t CallbackUserData);
+
+protected:
+	// --------------------------------------------------------------------------
+	// Initializes DSP modules, parameters, views and parameter groups.
+	// WithMix : the effect has its own dry/wet parameter (standalone)
+	void InitializeEffect(uint32_t SerializeID, uint8_t MidiCCBase, bool WithMix);
+
+	// ==============================================================================
+	// User Interface Components
+	// ==============================================================================
+
+	// Parameters
+	DadUI::cParameter m_LowCut;							// Low cut frequency (Hz)
+	DadUI::cParameter m_LowFreq;						// Low shelf frequency (Hz)
+	DadUI::cParameter m_LowGain;						// Low shelf gain (dB)
+	DadUI::cParameter m_MidFreq[EQ_NB_MID_BANDS];		// Peaking bands frequency (Hz)
+	DadUI::cParameter m_MidGain[EQ_NB_MID_BANDS];		// Peaking bands gain (dB)
+	DadUI::cParameter m_MidWidth[EQ_NB_MID_BANDS];		// Peaking bands width (octave)
+	DadUI::cParameter m_HighFreq;						// High shelf frequency (Hz)
+	DadUI::cParameter m_HighGain;						// High shelf gain (dB)
+	DadUI::cParameter m_HighCut;						// High cut frequency (Hz)
+	DadUI::cParameter m_DryWetMix;						// Mix dry/wet
+
+	// Views
+	DadUI::cParameterNumNormalView      m_LowCutView;
+	DadUI::cParameterNumNormalView      m_LowFreqView;
+	DadUI::cParameterNumLeftRightView   m_LowGainView;
+	DadUI::cParameterNumNormalView      m_MidFreqView[EQ_NB_MID_BANDS];
+	DadUI::cParameterNumLeftRightView   m_MidGainView[EQ_NB_MID_BANDS];
+	DadUI::cParameterNumNormalView      m_MidWidthView[EQ_NB_MID_BANDS];
+	DadUI::cParameterNumNormalView      m_HighFreqView;
+	DadUI::cParameterNumLeftRightView   m_HighGainView;
+	DadUI::cParameterNumNormalView      m_HighCutView;
+	DadUI::cParameterNumNormalView      m_DryWetMixView;
+
+	// UI parameter groups (response curve in the main view)
+	DadUI::cUIResponseView              m_ResponseView;
+	DadUI::cUIResponseParameters        m_ItemLowMenu;
+	DadUI::cUIResponseParameters        m_ItemMidMenu[EQ_NB_MID_BANDS];
+	DadUI::cUIResponseParameters        m_ItemHighMenu;
+	DadUI::cUIParameters                m_ItemMixMenu;
+	DadUI::cUIMemory                    m_ItemMenuMemory;       // Persistent parameter storage
+	DadUI::cUIImputVolume               m_ItemInputVolume;      // Input volume menu
+
+	// Main menu container
+	DadUI::cUIMenu m_Menu;
+
+	// ==============================================================================
+	// DSP Components
+	// ==============================================================================
+
+	DadDSP::cBiQuadCascade	m_EQ;					// Low cut, bands, high cut
+	float					m_GainWet;
+	bool					m_InputMeter = false;	// Feed the input VU-meter (standalone)
+};
+
+} // namespace DadEffect
@@ -8,12 +8,14 @@
 // Copyright (c) 2025 Dad Design.
 //====================================================================================
 #include "main.h"
+#include "AudioBlock.h"
 #include "PendaUI.h"
 #include "UIComponent.h"
 #include "Parameter.h"
-#include "cDCO.h"
-#include "cDelayLine.h"
+#include "cDCOBank.h"
+#include "cBlockDelayLine.h"
 #include "UISystem.h"
+#include "EffectInterface.h"
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wmultichar"
@@ -22,6 +24,52 @@ constexpr uint32_t TremoloSerializeID ='Tre0'; // SerializeID for Delay Effect
 
 namespace DadEffect {
 
+// Vibrato delay lines: 4-point interpolation of the modulated delay
+using tModulationLine = DadDSP::cBlockDelayLine<DadDSP::cHermiteInterpolator>;
+
+// LFOs of the bank (left / right, half a period apart)
+constexpr size_t LFO_LEFT  = 0;
+constexpr size_t LFO_RIGHT = 1;
+constexpr size_t LFO_COUNT = 2;
+
+// Gain curve of the triangle LFO: intervals of its table
+constexpr uint32_t TREMOLO_GAIN_SIZE = 256;
+
+//***********************************************************************************
+//  cTremoloGain
+//
+//  Volume modulation of the tremolo from the LFO values (0 to 1), for a depth
+//  D = sin(depth * pi/2):
+//   - triangle : sin(1 - (D * (1 - LFO) * pi/2)), interpolated in a table of
+//                the curve (error below 5e-6)
+//   - square   : 1 - (D * (1 - LFO)), computed per frame as the LFO steps
+//                (a separate pass over the block costs more than it saves)
+//  Both are affine in LFO before the curve: the depth constants are only
+//  computed when the depth changes.
+//***********************************************************************************
+class cTremoloGain {
+public:
+	// --------------------------------------------------------------------------
+	// Sets the depth (0 to 100 %)
+	void setDepth(float Depth);
+
+	// --------------------------------------------------------------------------
+	// Gains of Size LFO values
+	ITCM void Triangle(const float *pLFO, float *pGain, size_t Size) const;
+
+	// --------------------------------------------------------------------------
+	// Gain of one LFO value
+	inline float Square(float LFO) const {
+		return 1 - (m_Deep * (1 - LFO));
+	}
+
+protected:
+	float m_Deep = 0.0f;			// D
+	float m_Offset = 1.0f;			// 1 - D
+	float m_CurveOffset = 0.0f;		// Table position: m_CurveOffset + (m_CurveScale * LFO)
+	float m_CurveScale = 0.0f;
+};
+
 //***********************************************************************************
 //  cTremolo
 //
@@ -30,7 +78,7 @@ namespace DadEffect {
 //  vibrato (pitch modulation), and user interface integration.
 //***********************************************************************************
 
-class cTremolo {
+class cTremolo : public iEffect {
 public:
 	// --------------------------------------------------------------------------
 	// Constructor
@@ -39,21 +87,61 @@ public:
 
 	// --------------------------------------------------------------------------
 	// Initializes DSP modules, LFO, delay buffers, and UI parameters.
-	void Initialize();
+	void Initialize() override;
+
+	// --------------------------------------------------------------------------
+	// Initializes DSP modules and parameters for an effect chain slot.
+	void InitializeSlot(uint32_t SerializeID, uint8_t MidiCCBase) override;
+
+	// --------------------------------------------------------------------------
+	// Main menu (standalone).
+	DadUI::cUIMenu *getMenu() override { return &m_Menu; }
+
+	// --------------------------------------------------------------------------
+	// Adds the tremolo parameter pages to a menu.
+	void AddMenuItems(DadUI::cUIMenu &Menu) override;
+
+	// --------------------------------------------------------------------------
+	// Connects tap tempo to the LFO frequency.
+	void InitTapTempo(DadUI::cTapTempo &TapTempo) override;
 
 	// --------------------------------------------------------------------------
 	// Audio processing function
-	// Applies tremolo and vibrato to the input audio buffer.
-	ITCM void Process(AudioBuffer *pIn, AudioBuffer *pOut, bool OnOff);
+	// Applies tremolo and vibrato to a block of audio frames.
+	ITCM void Process(const AudioBlock &In, const AudioBlock &Out) override;
+
+	// --------------------------------------------------------------------------
+	// Block processing on interleaved frames (zero-copy adapter).
+	inline void Process(const AudioBuffer *pIn, AudioBuffer *pOut, size_t nFrames){
+		Process(AudioBlock::Interleaved(pIn, nFrames), AudioBlock::Interleaved(pOut, nFrames));
+	}
+
+	// --------------------------------------------------------------------------
+	// Per-sample processing (compatibility adapter over the block path).
+	inline void ProcessSample(const AudioBuffer *pIn, AudioBuffer *pOut){
+		Process(pIn, pOut, 1);
+	}
 
 	// --------------------------------------------------------------------------
 	// UI Callbacks
 	// Triggered when related parameters are changed by the user.
-	static void SpeedChange(DadUI::cParameter *pParameter, uint32_t CallbackUserData);
-	static void RatioChange(DadUI::cParameter *pParameter, uint32_t CallbackUserData);
-	static void MixChange(DadUI::cParameter *pParameter, uint32_t CallbackUserData);
+	static void SpeedChange(DadUI::cParameter *pParameter, uintptr_t CallbackUserData);
+	static void RatioChange(DadUI::cParameter *pParameter, uintptr_t CallbackUserData);
+	static void MixChange(DadUI::cParameter *pParameter, uintptr_t CallbackUserData);
+	static void DeepChange(DadUI::cParameter *pParameter, uintptr_t CallbackUserData);
 
 protected:
+	// --------------------------------------------------------------------------
+	// Initializes DSP modules, parameters, views and parameter groups.
+	// WithMix : the effect has its own dry/wet parameter (standalone)
+	void InitializeEffect(uint32_t SerializeID, uint8_t MidiCCBase, bool WithMix);
+
+	// --------------------------------------------------------------------------
+	// Steps the LFOs over a block: vibrato delays and LFO values of every frame
+	// (shape and stereo vibrato resolved per block)
+	template<bool Square, bool StereoVibrato>
+	ITCM void StepLFO(size_t Size, float BlockDelay, float VibratoScale,
+					  AudioPlanarBuffer<AUDIO_BUFFER_SIZE_MAX> &Delays, AudioPlanarBuffer<AUDIO_BUFFER_SIZE_MAX> &LFO);
 
 	// ==============================================================================
 	// User Interface Components
@@ -95,13 +183,14 @@ protected:
 	// DSP Components
 	// ==============================================================================
 
-	DadDSP::cDCO m_LFOLeft;                 // Low-Frequency Oscillator for Left modulation
-	DadDSP::cDCO m_LFORight;                // Low-Frequency Oscillator for Right modulation
+	DadDSP::cDCOBank<LFO_COUNT> m_LFO;      // Low-Frequency Oscillators, left and right modulation
+	cTremoloGain m_Gain;                    // Volume modulation (depth constants and curve)
 
 	// Delay lines for vibrato (stereo processing)
-	DadDSP::cDelayLine m_ModulationLineRight;
-	DadDSP::cDelayLine m_ModulationLineLeft;
+	tModulationLine m_ModulationLineRight;
+	tModulationLine m_ModulationLineLeft;
 	float 			   m_GainWet;
+	bool			   m_InputMeter = false;	// Feed the input VU-meter (standalone)
 
 	// Compensation factor to maintain vibrato depth regardless of LFO frequency
 	float m_CoefComp = 0.0f;
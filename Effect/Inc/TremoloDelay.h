@@ -0,0 +1,41 @@
+#pragma once
+//====================================================================================
+// TremoloDelay.h
+//
+// Tremolo -> Delay effect chain.
+//
+// Copyright(c) 2025 Dad Design.
+//====================================================================================
+#include "EffectChain.h"
+#include "Tremolo.h"
+#include "Delay.h"
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmultichar"
+constexpr uint32_t TremoloDelaySerializeID ='TrD0'; // SerializeID for Tremolo -> Delay chain
+#pragma GCC diagnostic pop
+
+namespace DadEffect {
+
+//***********************************************************************************
+//  cTremoloDelay
+//
+//  Tremolo followed by Delay, each with its own bypass and dry/wet.
+//  Tap tempo drives the delay time.
+//***********************************************************************************
+class cTremoloDelay : public cEffectChainHost {
+public:
+	// --------------------------------------------------------------------------
+	// Constructor (initializes nothing by itself).
+	cTremoloDelay() {};
+
+	// --------------------------------------------------------------------------
+	// Initializes the effects and the chain user interface.
+	void Initialize();
+
+protected:
+	cTremolo	m_Tremolo;
+	cDelay		m_Delay;
+};
+
+} // namespace DadEffect
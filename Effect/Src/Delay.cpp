@@ -7,8 +7,9 @@
 //====================================================================================
 
 #include "Delay.h"
+#include "FastMath.h"
 
-constexpr float DELAY_MAX_TIME = 1.5f; // Maximum delay time in seconds
+constexpr float DELAY_MAX_TIME = 5.0f; // Maximum delay time in seconds
 
 // Utility to round up to the next uint
 constexpr uint32_t ceil_to_uint(float value) {
@@ -18,11 +19,13 @@ constexpr uint32_t ceil_to_uint(float value) {
 // Calculate buffer size based on sampling rate and max delay time
 constexpr uint32_t DELAY_BUFFER_SIZE = ceil_to_uint(SAMPLING_RATE * DELAY_MAX_TIME);
 
-// Allocate delay buffers in SDRAM (extra 100 samples for interpolation safety)
-SDRAM_SECTION	float 	__DelayBufferLeft[DELAY_BUFFER_SIZE+100];
-SDRAM_SECTION   float 	__DelayBufferRight[DELAY_BUFFER_SIZE+100];
-SDRAM_SECTION	float 	__Delay2BufferLeft[(DELAY_BUFFER_SIZE)+100];
-SDRAM_SECTION   float 	__Delay2BufferRight[(DELAY_BUFFER_SIZE)+100];
+// Delay buffers are allocated in the SDRAM effect arena
+// (power of two capacity, extra 100 samples for interpolation safety)
+constexpr uint32_t DELAY_BUFFER_ALLOC = DadEffect::tDelayLine::getCapacity(DELAY_BUFFER_SIZE + 100);
+constexpr size_t DELAY_BUFFER_CELLS = DadEffect::tDelayLine::getCells(DELAY_BUFFER_ALLOC);
+
+// Maximum rate of the tone filter coefficient calculations (Hz)
+constexpr float TONE_CONTROL_RATE = 1000.0f;
 
 namespace DadEffect {
 
@@ -46,6 +49,40 @@ void cDelay::Initialize(){
 	DadUI::cPendaUI::m_Volumes.MuteOn();
 	m_GainWet = 0;
 
+	InitializeEffect(DelaySerializeID, 20, true);
+
+	m_ItemInputVolume.Init();
+	m_ItemMenuMemory.Init(DelaySerializeID);
+	m_InputMeter = true;
+
+	// Build Main Menu -----------------------------------------------------------------------
+	m_Menu.Init();
+	AddMenuItems(m_Menu);
+	m_Menu.addMenuItem(&m_ItemMenuMemory, "Mem.");
+	m_Menu.addMenuItem(&m_ItemInputVolume, "Input");
+
+	// Tap tempo sync (from footswitch)
+	InitTapTempo(m_TapTempo);
+
+	// Activate delay UI
+	DadUI::cPendaUI::setActiveObject(&m_Menu);
+
+	// ---------------- Volume Initialization ----------------
+	DadUI::cPendaUI::m_Volumes.MuteOff();
+}
+
+// --------------------------------------------------------------------------
+// Initializes DSP components and parameters for an effect chain slot
+// (mix, memory and input volume are handled by the chain)
+void cDelay::InitializeSlot(uint32_t SerializeID, uint8_t MidiCCBase){
+	m_GainWet = 1.0f;
+	m_InputMeter = false;
+	InitializeEffect(SerializeID, MidiCCBase, false);
+}
+
+// --------------------------------------------------------------------------
+// Initializes DSP components, parameters, views and parameter groups
+void cDelay::InitializeEffect(uint32_t SerializeID, uint8_t MidiCCBase, bool WithMix){
 	// Member data Initialization ----------------------------------------------------------
 	m_MemMixDelay = 0.0f;		// Memorize MixDelay Value
 	m_MemVol1Left = 0.0f;		// Memorize Vol1Left
@@ -56,14 +93,20 @@ void cDelay::Initialize(){
 	m_BassFilter2.Initialize(SAMPLING_RATE, 100, 0.0f, 1.8f, DadDSP::FilterType::HPF);
 	m_TrebleFilter2.Initialize(SAMPLING_RATE, 1000, 0.0f, 1.8f, DadDSP::FilterType::LPF);
 
-	m_Delay1LineRight.Initialize(__DelayBufferRight, DELAY_BUFFER_SIZE);
+	// Tone controls move the coefficients at a bounded rate (see BassChange)
+	m_BassFilter1.setControlRate(TONE_CONTROL_RATE);
+	m_TrebleFilter1.setControlRate(TONE_CONTROL_RATE);
+	m_BassFilter2.setControlRate(TONE_CONTROL_RATE);
+	m_TrebleFilter2.setControlRate(TONE_CONTROL_RATE);
+
+	m_Delay1LineRight.Initialize(__EffectArena.AllocateArray<tDelayLine::tCell>(DELAY_BUFFER_CELLS), DELAY_BUFFER_ALLOC);
 	m_Delay1LineRight.Clear();
-	m_Delay1LineLeft.Initialize(__DelayBufferLeft, DELAY_BUFFER_SIZE);
+	m_Delay1LineLeft.Initialize(__EffectArena.AllocateArray<tDelayLine::tCell>(DELAY_BUFFER_CELLS), DELAY_BUFFER_ALLOC);
 	m_Delay1LineLeft.Clear();
 
-	m_Delay2LineRight.Initialize(__Delay2BufferRight, DELAY_BUFFER_SIZE);
+	m_Delay2LineRight.Initialize(__EffectArena.AllocateArray<tDelayLine::tCell>(DELAY_BUFFER_CELLS), DELAY_BUFFER_ALLOC);
 	m_Delay2LineRight.Clear();
-	m_Delay2LineLeft.Initialize(__Delay2BufferLeft, DELAY_BUFFER_SIZE);
+	m_Delay2LineLeft.Initialize(__EffectArena.AllocateArray<tDelayLine::tCell>(DELAY_BUFFER_CELLS), DELAY_BUFFER_ALLOC);
 	m_Delay2LineLeft.Clear();
 
 	m_LFO.Initialize(SAMPLING_RATE, 0.5, 1, 10, 0.5f);
@@ -72,40 +115,48 @@ void cDelay::Initialize(){
 
 	// Delay 1 ----------------------
 	m_Time.Init(0.450f, 0.150f, DELAY_MAX_TIME, 0.05f, 0.01f, nullptr, 0,
-	            5.0f * UI_RT_SAMPLING_RATE, 20, DelaySerializeID);
+	            5.0f * UI_RT_SAMPLING_RATE, MidiCCBase, SerializeID);
 
 	// Feedback for delay 1
 	m_Repeat.Init(30.0f, 0.0f, 100.0f, 5.0f, 1.0f, nullptr, 0,
-	            0.2f * UI_RT_SAMPLING_RATE, 21, DelaySerializeID);
+	            0.2f * UI_RT_SAMPLING_RATE, MidiCCBase + 1, SerializeID);
 
 	// Total mix delay
-	m_Mix.Init(10.0f, 0.0f, 100.0f, 5.0f, 1.0f, MixChange, (uint32_t) this,
-					 0, 22, DelaySerializeID);
+	if(WithMix){
+		m_Mix.Init(10.0f, 0.0f, 100.0f, 5.0f, 1.0f, MixChange, (uintptr_t) this,
+						 0, MidiCCBase + 2, SerializeID);
+	}
 	// Delay 2 ----------------------
 	// Subdivision of delay1
-	m_SubDelay.Init(0.0f, 0.0f, 0.0f, 1.0f, 1.0f, nullptr, 0, 0, 23, DelaySerializeID);
+	m_SubDelay.Init(0.0f, 0.0f, 0.0f, 1.0f, 1.0f, nullptr, 0, 0, MidiCCBase + 3, SerializeID);
 
 	// Feedback level for delay 2
 	m_RepeatDelay2.Init(0.0f, 0.0f, 100.0f, 5.0f, 1.0f, nullptr, 0,
-            0.2f * UI_RT_SAMPLING_RATE, 24, DelaySerializeID);
+            0.2f * UI_RT_SAMPLING_RATE, MidiCCBase + 4, SerializeID);
 
 	// blend of delay 1 and delay 2
 	m_BlendD1D2.Init(0.0f, 0.0f, 100.0f, 5.0f, 1.0f, nullptr, 0,
-			 1.0f * UI_RT_SAMPLING_RATE, 25, DelaySerializeID);
+			 1.0f * UI_RT_SAMPLING_RATE, MidiCCBase + 5, SerializeID);
 
 	// Tone controls -----------------
-	m_Bass.Init(50.0f, 0.0f, 100.0f, 5.0f, 1.0f, BassChange, (uint32_t)this,
-	            0.2f * UI_RT_SAMPLING_RATE, 26, DelaySerializeID);
+	m_Bass.Init(50.0f, 0.0f, 100.0f, 5.0f, 1.0f, BassChange, (uintptr_t)this,
+	            0.2f * UI_RT_SAMPLING_RATE, MidiCCBase + 6, SerializeID);
 
-	m_Treble.Init(50.0f, 0.0f, 100.0f, 5.0f, 1.0f, TrebleChange, (uint32_t)this,
-	              0.2f * UI_RT_SAMPLING_RATE, 27, DelaySerializeID);
+	m_Treble.Init(50.0f, 0.0f, 100.0f, 5.0f, 1.0f, TrebleChange, (uintptr_t)this,
+	              0.2f * UI_RT_SAMPLING_RATE, MidiCCBase + 7, SerializeID);
 
 	// Modulation depth and speed
 	m_ModulationDeep.Init(10.0f, 0.0f, 100.0f, 5.0f, 1.0f, nullptr, 0,
-	                      1.0f * UI_RT_SAMPLING_RATE, 28, DelaySerializeID);
+	                      1.0f * UI_RT_SAMPLING_RATE, MidiCCBase + 8, SerializeID);
 
 	m_ModulationSpeed.Init(1.5f, 0.5f, 10.0f, 0.5f, 0.05f, SpeedChange,
-	                       (uint32_t)this, 0.5f * UI_RT_SAMPLING_RATE, 29, DelaySerializeID);
+	                       (uintptr_t)this, 0.5f * UI_RT_SAMPLING_RATE, MidiCCBase + 9, SerializeID);
+
+	// Multi-tap pattern and stereo spread (no MIDI CC: the 10 CCs of a chain
+	// slot are taken)
+	m_TapPattern.Init(0.0f, 0.0f, 0.0f, 1.0f, 1.0f, nullptr, 0, 0, 0xFF, SerializeID);
+	m_TapSpread.Init(50.0f, 0.0f, 100.0f, 5.0f, 1.0f, nullptr, 0,
+	                 0.5f * UI_RT_SAMPLING_RATE, 0xFF, SerializeID);
 
 	// Parameter Views Setup -----------------------------------------------------------------
 	m_TimeView.Init(&m_Time, "Time", "Time", "s", "second");
@@ -135,11 +186,20 @@ void cDelay::Initialize(){
 	m_ModulationDeepView.Init(&m_ModulationDeep, "Deep", "Mod. Deep", "%", "%");
 	m_ModulationSpeedView.Init(&m_ModulationSpeed, "Speed", "Mod. Speed", "Hz", "Hz");
 
+	// Discrete values of the multi-tap patterns (__TapPatterns)
+	m_TapPatternView.Init(&m_TapPattern, "Taps", "Multi-Tap");
+	m_TapPatternView.AddDiscreteValue("Off", "Dual delay");
+	m_TapPatternView.AddDiscreteValue("8th", "Straight 8th");
+	m_TapPatternView.AddDiscreteValue("Dot.", "Dotted");
+	m_TapPatternView.AddDiscreteValue("Trip.", "Triplet");
+	m_TapPatternView.AddDiscreteValue("Swing", "Swing");
+	m_TapSpreadView.Init(&m_TapSpread, "Spread", "Tap Spread", "%", "%");
+
 	// Organize parameters into menu groups --------------------------------------------------
 #ifdef PENDAI
 	m_ItemDelay1Menu.Init(&m_TimeView, nullptr, &m_RepeatView);
 #elif defined(PENDAII)
-	m_ItemDelay1Menu.Init(&m_TimeView, &m_RepeatView, &m_MixView);
+	m_ItemDelay1Menu.Init(&m_TimeView, &m_RepeatView, WithMix ? &m_MixView : nullptr);
 #endif
 	m_ItemDelay2Menu.Init(&m_SubDelayView, &m_RepeatDelay2View, &m_BlendD1D2View);
 
@@ -147,181 +207,248 @@ void cDelay::Initialize(){
 
 	m_ItemLFOMenu.Init(&m_ModulationDeepView, nullptr, &m_ModulationSpeedView);
 
-	m_ItemInputVolume.Init();
-	m_ItemMenuMemory.Init(DelaySerializeID);
-
-	// Build Main Menu -----------------------------------------------------------------------
-	m_Menu.Init();
-	m_Menu.addMenuItem(&m_ItemDelay1Menu, "Delay1");
-	m_Menu.addMenuItem(&m_ItemDelay2Menu, "Delay2");
-	m_Menu.addMenuItem(&m_ItemToneMenu, "Tone");
-	m_Menu.addMenuItem(&m_ItemLFOMenu, "LFO");
-	m_Menu.addMenuItem(&m_ItemMenuMemory, "Mem.");
-	m_Menu.addMenuItem(&m_ItemInputVolume, "Input");
-
-	// Tap tempo sync (from footswitch)
-	m_TapTempo.Init(&DadUI::cPendaUI::m_FootSwitch2, &m_TimeView, DadUI::eTempoType::period);
-
-	// Activate delay UI
-	DadUI::cPendaUI::setActiveObject(&m_Menu);
-
-	// LFO and Filters Initialization --------------------------------------------------------
-	m_LFO.Initialize(SAMPLING_RATE, 0.5, 1, 10, 0.5f);
+	m_ItemTapsMenu.Init(&m_TapPatternView, nullptr, &m_TapSpreadView);
+}
 
-	// ---------------- Volume Initialization ----------------
-	DadUI::cPendaUI::m_Volumes.MuteOff();
+// --------------------------------------------------------------------------
+// Adds the delay parameter pages to a menu
+void cDelay::AddMenuItems(DadUI::cUIMenu &Menu){
+	Menu.addMenuItem(&m_ItemDelay1Menu, "Delay1");
+	Menu.addMenuItem(&m_ItemDelay2Menu, "Delay2");
+	Menu.addMenuItem(&m_ItemToneMenu, "Tone");
+	Menu.addMenuItem(&m_ItemLFOMenu, "LFO");
+	Menu.addMenuItem(&m_ItemTapsMenu, "Taps");
 }
 
 // --------------------------------------------------------------------------
-// Main audio processing function
-void cDelay::Process(AudioBuffer *pIn, AudioBuffer *pOut, bool OnOff){
-	m_LFO.Step();
-	m_ItemInputVolume.Process(pIn);		// Input volume VU-Meter
-
-	// Compute modulated delay time
-	float LFO1 =  m_LFO.getTriangleValue();
-	float LFO2 =  m_LFO.getTriangleValuePhased(0.25f);
-	float Delay = m_Time * SAMPLING_RATE;
-	float DelayL = Delay - (LFO1  *  m_ModulationDeep * 0.8);
-	float DelayR = Delay - (LFO2  *  m_ModulationDeep * 0.8);
-
-	// Compute musical subdivision for delay 2
-	float SubDelayL;
-	float SubDelayR;
-
-	switch((uint32_t) m_SubDelay.getValue()){
-		case 0:
-			SubDelayL = DelayL/8.0f;		 	// 0.125
-			SubDelayR = DelayR/8.0f;		 	// 0.125
-			break;
-		case 1:
-			SubDelayL = DelayL/6.0f;          // 0.166
-			SubDelayR = DelayR/6.0f;          // 0.166
-			break;
-		case 2:
-			SubDelayL = DelayL/4.0f;          // 0.250
-			SubDelayR = DelayR/4.0f;          // 0.250
-			break;
-		case 3:
-			SubDelayL = DelayL/3.0f; 		 	// 0.333
-			SubDelayR = DelayR/3.0f; 		 	// 0.333
-			break;
-		case 4:
-			SubDelayL = DelayL * 3.0f / 8.0f; //0.375
-			SubDelayR = DelayR * 3.0f / 8.0f; //0.375
-			break;
-		case 5:
-			SubDelayL = DelayL * 5.0f / 8.0f; // 0.625
-			SubDelayR = DelayR * 5.0f / 8.0f; // 0.625
-			break;
-		case 6:
-			SubDelayL = DelayL * 2.0f / 3.0f; // 0.666
-			SubDelayR = DelayR * 2.0f / 3.0f; // 0.666
-			break;
-		case 7:
-			SubDelayL = DelayL * 3.0f / 4.0f; // 0.750
-			SubDelayR = DelayR * 3.0f / 4.0f; // 0.750
-			break;
-		case 8:
-			SubDelayL = DelayL * 5.0f / 6.0f;	// 0.833
-			SubDelayR = DelayR * 5.0f / 6.0f;	// 0.833
-			break;
-		case 9:
-			SubDelayL = DelayL * 7.0f / 8.0f;	// 0.875
-			SubDelayR = DelayR * 7.0f / 8.0f;	// 0.875
-			break;
-		default:
-			SubDelayL = DelayL;
-			SubDelayR = DelayR;
-	}
+// Connects tap tempo (footswitch 2) to the delay time
+void cDelay::InitTapTempo(DadUI::cTapTempo &TapTempo){
+	TapTempo.Init(&DadUI::cPendaUI::m_FootSwitch2, &m_TimeView, DadUI::eTempoType::period);
+}
 
-	// --- Delay Processing 1 ---
-	float OutRight = m_Delay1LineRight.Pull(DelayR);
-	float OutLeft  = m_Delay1LineLeft.Pull(DelayL);
+// --------------------------------------------------------------------------
+// Longest silence before a repeat: the delay line length
+float cDelay::getTailTime() const{
+	return DELAY_MAX_TIME;
+}
 
-	OutRight = m_BassFilter1.Process(OutRight, DadDSP::eChannel::Right);
-	OutLeft  = m_BassFilter1.Process(OutLeft, DadDSP::eChannel::Left);
+// --------------------------------------------------------------------------
+// Sub delay ratios (indexed by m_SubDelay)
+static constexpr float __SubDelayRatio[] = {
+	1.0f / 8.0f,	// 0.125
+	1.0f / 6.0f,	// 0.166
+	1.0f / 4.0f,	// 0.250
+	1.0f / 3.0f,	// 0.333
+	3.0f / 8.0f,	// 0.375
+	5.0f / 8.0f,	// 0.625
+	2.0f / 3.0f,	// 0.666
+	3.0f / 4.0f,	// 0.750
+	5.0f / 6.0f,	// 0.833
+	7.0f / 8.0f		// 0.875
+};
+constexpr uint32_t NB_SUB_DELAY = sizeof(__SubDelayRatio) / sizeof(__SubDelayRatio[0]);
 
-	OutRight = m_TrebleFilter1.Process(OutRight, DadDSP::eChannel::Right);
-	OutLeft  = m_TrebleFilter1.Process(OutLeft, DadDSP::eChannel::Left);
+// --------------------------------------------------------------------------
+// Multi-tap patterns (indexed by m_TapPattern - 1): positions of the taps as
+// ratios of the delay time, ascending, and their gains (accents on the beats).
+// The last tap is the delay time itself.
+struct sTapPattern {
+	float Ratio[DELAY_NB_TAPS];
+	float Gain[DELAY_NB_TAPS];
+};
 
-	m_Delay1LineRight.Push((pIn->Right + OutRight) * m_Repeat/100);
-	m_Delay1LineLeft.Push((pIn->Left + OutLeft) * m_Repeat/100);
+static constexpr sTapPattern __TapPatterns[] = {
+	// Straight 8th
+	{{1.0f/8, 2.0f/8, 3.0f/8, 4.0f/8, 5.0f/8, 6.0f/8, 7.0f/8, 1.0f},
+	 {0.35f, 0.60f, 0.35f, 0.60f, 0.35f, 0.60f, 0.35f, 0.60f}},
+	// Dotted 8th over quarters
+	{{3.0f/16, 4.0f/16, 6.0f/16, 8.0f/16, 9.0f/16, 12.0f/16, 15.0f/16, 1.0f},
+	 {0.50f, 0.35f, 0.50f, 0.35f, 0.50f, 0.45f, 0.50f, 0.60f}},
+	// Triplet 8th
+	{{2.0f/12, 3.0f/12, 4.0f/12, 6.0f/12, 7.0f/12, 8.0f/12, 10.0f/12, 1.0f},
+	 {0.35f, 0.60f, 0.35f, 0.60f, 0.35f, 0.35f, 0.35f, 0.60f}},
+	// Swing 16th (long - short pairs)
+	{{3.0f/16, 4.0f/16, 7.0f/16, 8.0f/16, 11.0f/16, 12.0f/16, 15.0f/16, 1.0f},
+	 {0.40f, 0.60f, 0.40f, 0.60f, 0.40f, 0.60f, 0.40f, 0.60f}},
+};
+constexpr uint32_t NB_TAP_PATTERNS = sizeof(__TapPatterns) / sizeof(__TapPatterns[0]);
 
-	// --- Delay Processing 2 ---
-	float Out2Right;
-	float Out2Left;
-	if(m_RepeatDelay2 == 0){
-		Out2Right = m_Delay1LineRight.Pull(SubDelayR);
-		Out2Left  = m_Delay1LineLeft.Pull(SubDelayL);
-	}else{
-		Out2Right = m_Delay2LineRight.Pull(SubDelayR);
-		Out2Left  = m_Delay2LineLeft.Pull(SubDelayL);
+// --------------------------------------------------------------------------
+// Main audio processing function (block of frames)
+void cDelay::Process(const AudioBlock &In, const AudioBlock &Out){
+	if(m_InputMeter){
+		m_ItemInputVolume.Process(In);	// Input volume VU-Meter
 	}
 
-	Out2Right = m_BassFilter2.Process(Out2Right, DadDSP::eChannel::Right);
-	Out2Left  = m_BassFilter2.Process(Out2Left, DadDSP::eChannel::Left);
+	// Per-block values ---------------------------------------------------------
+	// Parameters only change in cPendaUI::RTProcess(), called once per block
+	// before the effect, so everything derived from them is computed here.
+	const float Delay   = m_Time * SAMPLING_RATE;
+	const float ModDeep = m_ModulationDeep * 0.8f;
+	const float Repeat1 = m_Repeat / 100;
+	const float Repeat2 = m_RepeatDelay2 / 100;
+
+	// Musical subdivision for delay 2
+	const uint32_t SubDelay = static_cast<uint32_t>(m_SubDelay.getValue());
+	const float SubRatio = (SubDelay < NB_SUB_DELAY) ? __SubDelayRatio[SubDelay] : 1.0f;
+
+	// Delay 2 reads delay line 1 when it has no feedback of its own
+	tDelayLine &Delay2LineRight = (m_RepeatDelay2 == 0) ? m_Delay1LineRight : m_Delay2LineRight;
+	tDelayLine &Delay2LineLeft  = (m_RepeatDelay2 == 0) ? m_Delay1LineLeft  : m_Delay2LineLeft;
+
+	// Delay1 and Delay2 crossfade gains
+	const float mix   = m_BlendD1D2 / 100.0f;
+	float CrossCos, CrossSin;
+	DadDSP::FastSinCos(mix * 0.5f * M_PI, CrossSin, CrossCos);
+#ifdef PENDAI
+	const float gain1 = CrossCos; // Crossfade gain A
+	const float gain2 = CrossSin; // Crossfade gain B
+#elif defined(PENDAII)
+	const float gain1 = CrossCos * m_GainWet; // Crossfade gain A
+	const float gain2 = CrossSin * m_GainWet; // Crossfade gain B
+#endif
 
-	Out2Right = m_TrebleFilter2.Process(Out2Right, DadDSP::eChannel::Right);
-	Out2Left  = m_TrebleFilter2.Process(Out2Left, DadDSP::eChannel::Left);
+	// Delay 2 reading delay line 1 sees the sample delay 1 pushed for the same frame
+	const float Delay2Shift = (m_RepeatDelay2 == 0) ? 1.0f : 0.0f;
+
+	// Multi-tap mode: delay 2 is the mix of the pattern taps of delay line 1.
+	// The taps are whole samples; the modulation (ModDeep - LFO x ModDeep >= 0)
+	// is added to all of them with one interpolation per frame.
+	const uint32_t Pattern = static_cast<uint32_t>(m_TapPattern.getValue());
+	const bool MultiTap = (Pattern != 0) && (Pattern <= NB_TAP_PATTERNS);
+	uint32_t TapDelays[DELAY_NB_TAPS];
+	float TapGainsLeft[DELAY_NB_TAPS];
+	float TapGainsRight[DELAY_NB_TAPS];
+	if(MultiTap){
+		const sTapPattern &Taps = __TapPatterns[Pattern - 1];
+		const float Spread = m_TapSpread / 100.0f;
+		for(uint8_t Tap = 0; Tap < DELAY_NB_TAPS; Tap++){
+			// Taps panned alternately left and right
+			float Pan = (Tap & 1) ? Spread : -Spread;
+			TapDelays[Tap] = static_cast<uint32_t>((Delay * Taps.Ratio[Tap]) - ModDeep);
+			TapGainsLeft[Tap]  = Taps.Gain[Tap] * ((Pan > 0.0f) ? 1.0f - Pan : 1.0f);
+			TapGainsRight[Tap] = Taps.Gain[Tap] * ((Pan < 0.0f) ? 1.0f + Pan : 1.0f);
+		}
+	}
 
-	m_Delay2LineRight.Push((pIn->Right + Out2Right) * m_RepeatDelay2/100);
-	m_Delay2LineLeft.Push((pIn->Left + Out2Left) * m_RepeatDelay2/100);
+	// Delay outputs of the block -------------------------------------------------
+	// The shortest delay (Time 150 ms x 1/8, minus the modulation) is far longer
+	// than a block: every sample read by this block was pushed by a previous one.
+	// The delay of frame Index is counted from the write position of the block
+	// start plus Index (cBlockDelayLine::Read).
+	AudioPlanarBuffer<AUDIO_BUFFER_SIZE_MAX> Wet1;
+	AudioPlanarBuffer<AUDIO_BUFFER_SIZE_MAX> Wet2;
+	AudioPlanarBuffer<AUDIO_BUFFER_SIZE_MAX> Delay1;	// Modulated delays (samples)
+	AudioPlanarBuffer<AUDIO_BUFFER_SIZE_MAX> Delay2;
+
+	for(size_t Index = 0; Index < In.Size; Index++){
+		m_LFO.Step();
+
+		// Compute modulated delay time
+		float LFO1 =  m_LFO.getTriangleValue();
+		float LFO2 =  m_LFO.getTriangleValuePhased(0.25f);
+		float DelayL = Delay - (LFO1 * ModDeep);
+		float DelayR = Delay - (LFO2 * ModDeep);
+
+		Delay1.Right[Index] = DelayR;
+		Delay1.Left[Index]  = DelayL;
+		if(MultiTap){
+			Delay2.Right[Index] = ModDeep - (LFO2 * ModDeep);
+			Delay2.Left[Index]  = ModDeep - (LFO1 * ModDeep);
+		}else{
+			Delay2.Right[Index] = (DelayR * SubRatio) - Delay2Shift;
+			Delay2.Left[Index]  = (DelayL * SubRatio) - Delay2Shift;
+		}
+	}
 
-	// --- Delay1 ans Delay2  Blending ---
-	float mix = m_BlendD1D2 / 100.0f;
-	float gain1 = cosf(mix * 0.5f * M_PI); // Crossfade gain A
-	float gain2 = sinf(mix * 0.5f * M_PI); // Crossfade gain B
+	// (Delay1 is filled for the In.Size frames read: GCC does not see it when
+	// the read is not inlined)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+	m_Delay1LineRight.Read(Wet1.Right, Delay1.Right, In.Size);
+	m_Delay1LineLeft.Read(Wet1.Left, Delay1.Left, In.Size);
+#pragma GCC diagnostic pop
+	if(MultiTap){
+		m_Delay1LineRight.ReadTaps(Wet2.Right, Delay2.Right, TapDelays, TapGainsRight, DELAY_NB_TAPS, In.Size);
+		m_Delay1LineLeft.ReadTaps(Wet2.Left, Delay2.Left, TapDelays, TapGainsLeft, DELAY_NB_TAPS, In.Size);
+	}else{
+		Delay2LineRight.Read(Wet2.Right, Delay2.Right, In.Size);
+		Delay2LineLeft.Read(Wet2.Left, Delay2.Left, In.Size);
+	}
 
-	OutRight = ((OutRight * gain1) + (Out2Right * gain2));
-	OutLeft  = ((OutLeft * gain1) + (Out2Left * gain2));
+	// Tone filters, both channels of the block in one pass -----------------------
+	AudioBlock Wet1Block = Wet1.getBlock(In.Size);
+	AudioBlock Wet2Block = Wet2.getBlock(In.Size);
+	m_BassFilter1.Process(Wet1Block, Wet1Block);
+	m_TrebleFilter1.Process(Wet1Block, Wet1Block);
+	m_BassFilter2.Process(Wet2Block, Wet2Block);
+	m_TrebleFilter2.Process(Wet2Block, Wet2Block);
+
+	// Feedback and output --------------------------------------------------------
+	// (the delay buffers are reused for the feedback samples of the block)
+	for(size_t Index = 0; Index < In.Size; Index++){
+		float OutRight  = Wet1.Right[Index];
+		float OutLeft   = Wet1.Left[Index];
+		float Out2Right = Wet2.Right[Index];
+		float Out2Left  = Wet2.Left[Index];
+
+		Delay1.Right[Index] = (In.R(Index) + OutRight) * Repeat1;
+		Delay1.Left[Index]  = (In.L(Index) + OutLeft) * Repeat1;
+
+		Delay2.Right[Index] = (In.R(Index) + Out2Right) * Repeat2;
+		Delay2.Left[Index]  = (In.L(Index) + Out2Left) * Repeat2;
+
+		// --- Delay1 ans Delay2  Blending ---
+		Out.R(Index) = (OutRight * gain1) + (Out2Right * gain2);
+		Out.L(Index) = (OutLeft * gain1) + (Out2Left * gain2);
+	}
 
-#ifdef PENDAI
-	pOut->Right = OutRight;
-	pOut->Left  = OutLeft;
-#elif defined(PENDAII)
-	pOut->Right = OutRight * m_GainWet;
-	pOut->Left  = OutLeft * m_GainWet;
-#endif
+	m_Delay1LineRight.Write(Delay1.Right, In.Size);
+	m_Delay1LineLeft.Write(Delay1.Left, In.Size);
+	m_Delay2LineRight.Write(Delay2.Right, In.Size);
+	m_Delay2LineLeft.Write(Delay2.Left, In.Size);
 }
 
 
 // --------------------------------------------------------------------------
 // Modulation speed callback (updates LFO frequency)
-void cDelay::SpeedChange(DadUI::cParameter *pParameter, uint32_t CallbackUserData){
+void cDelay::SpeedChange(DadUI::cParameter *pParameter, uintptr_t CallbackUserData){
 	cDelay * pthis = (cDelay *)CallbackUserData;
 	pthis->m_LFO.setFreq(pParameter->getValue());
 }
 
 // --------------------------------------------------------------------------
 // Bass control callback - sets high-pass filter frequency
+// Called on every ramp step (up to UI_RT_SAMPLING_RATE times per second): the
+// filters only record the new cutoff, their coefficients are calculated at
+// TONE_CONTROL_RATE and interpolated block by block.
 #define MIN_BASS_FREQ 30
 #define MAX_BASS_FREQ 600
-void cDelay::BassChange(DadUI::cParameter *pParameter, uint32_t CallbackUserData){
+void cDelay::BassChange(DadUI::cParameter *pParameter, uintptr_t CallbackUserData){
 	cDelay * pthis = (cDelay *)CallbackUserData;
 	float Freq = pthis->getLogFrequency(1.0f - pParameter->getNormalizedValue(), MIN_BASS_FREQ, MAX_BASS_FREQ);
 	pthis->m_BassFilter1.setCutoffFreq(Freq);
-	pthis->m_BassFilter1.CalculateParameters();
+	pthis->m_BassFilter1.UpdateParameters();
 	pthis->m_BassFilter2.setCutoffFreq(Freq);
-	pthis->m_BassFilter2.CalculateParameters();
+	pthis->m_BassFilter2.UpdateParameters();
 }
 
 // --------------------------------------------------------------------------
 // Treble control callback - sets low-pass filter frequency
 #define MIN_TREBLE_FREQ 600
 #define MAX_TREBLE_FREQ 12000
-void cDelay::TrebleChange(DadUI::cParameter *pParameter, uint32_t CallbackUserData){
+void cDelay::TrebleChange(DadUI::cParameter *pParameter, uintptr_t CallbackUserData){
 	cDelay * pthis = (cDelay *)CallbackUserData;
 	float Freq = pthis->getLogFrequency(pParameter->getNormalizedValue(), MIN_TREBLE_FREQ, MAX_TREBLE_FREQ);
 	pthis->m_TrebleFilter1.setCutoffFreq(Freq);
-	pthis->m_TrebleFilter1.CalculateParameters();
+	pthis->m_TrebleFilter1.UpdateParameters();
 	pthis->m_TrebleFilter2.setCutoffFreq(Freq);
-	pthis->m_TrebleFilter2.CalculateParameters();
+	pthis->m_TrebleFilter2.UpdateParameters();
 }
 
 // --------------------------------------------------------------------------
 // Callback to update the Mix parameter
-void cDelay::MixChange(DadUI::cParameter *pParameter, uint32_t CallbackUserData){
+void cDelay::MixChange(DadUI::cParameter *pParameter, uintptr_t CallbackUserData){
 	cDelay *pthis = reinterpret_cast<cDelay *>(CallbackUserData);
 	pthis->m_GainWet = DadUI::cPendaUI::m_Volumes.MixDryWet(*pParameter);
 }
@@ -329,10 +456,8 @@ void cDelay::MixChange(DadUI::cParameter *pParameter, uint32_t CallbackUserData)
 // --------------------------------------------------------------------------
 // Returns a frequency from a normalized value using a logarithmic scale
 float cDelay::getLogFrequency(float normValue, float freqMin, float freqMax) const{
-	float logMin = std::log(freqMin);
-	float logMax = std::log(freqMax);
-	float logFreq = logMin + normValue * (logMax - logMin);
-	return std::exp(logFreq);
+	// freqMin * (freqMax / freqMin)^normValue
+	return freqMin * DadDSP::FastExp2(normValue * DadDSP::FastLog2(freqMax / freqMin));
 };
 
 } // namespace DadEffect
@@ -0,0 +1,270 @@
+//====================================================================================
+// EffectChain.cpp
+//
+// Runtime host running several effects in series
+//
+// Copyright(c) 2025 Dad Design.
+//====================================================================================
+
+#include "EffectChain.h"
+#include <algorithm>
+#include <cmath>
+
+// First MIDI CC of the effect parameters of each slot (10 CCs per slot)
+static constexpr uint8_t __ChainSlotMidiCC[DadEffect::CHAIN_MAX_SLOTS] = {20, 30, 102};
+
+// Inter-stage blocks in DTCM (ping-pong between consecutive slots)
+using tChainBuffer = AudioPlanarBuffer<AUDIO_BUFFER_SIZE_MAX>;
+DTCM_SECTION tChainBuffer __ChainBuffer[2];
+
+// Effect input of a bypassed slot (faded out, then silent)
+DTCM_SECTION tChainBuffer __ChainSend;
+
+namespace DadEffect {
+
+//***********************************************************************************
+//  cEffectChainHost
+//***********************************************************************************
+
+// --------------------------------------------------------------------------
+// Prepares an empty chain
+void cEffectChainHost::InitChain(uint32_t SerializeID){
+	// ---------------- Volume Initialization ----------------
+	DadUI::cPendaUI::m_Volumes.BypassModeChange(DadMisc::eDryWetMode::DryAuto);
+	DadUI::cPendaUI::m_Volumes.MuteOn();
+	m_GainWet = 0;
+
+	m_SerializeID = SerializeID;
+	m_NbSlots = 0;
+	m_TapTempoSlot = -1;
+
+	__ChainBuffer[0].Clear();
+	__ChainBuffer[1].Clear();
+	__ChainSend.Clear();
+
+	// Global mix against the analog dry path
+	m_Mix.Init(100.0f, 0.0f, 100.0f, 5.0f, 1.0f, MixChange, (uintptr_t)this,
+	           0, CHAIN_MIDI_MIX, SerializeID);
+	m_MixView.Init(&m_Mix, "Mix", "Chain Mix", "%", "%");
+	m_ItemChainMenu.Init(nullptr, &m_MixView, nullptr);
+}
+
+// --------------------------------------------------------------------------
+// Appends an effect to the chain and initializes it for the slot
+bool cEffectChainHost::addSlot(iEffect *pEffect, const char *ShortName, const char *LongName, bool TapTempo){
+	if(m_NbSlots >= CHAIN_MAX_SLOTS){
+		return false;
+	}
+	uint8_t NumSlot = m_NbSlots;
+	sChainSlot &Slot = m_Slots[NumSlot];
+
+	Slot.pEffect = pEffect;
+	Slot.ShortName = ShortName;
+	Slot.DryGain = 1.0f;
+	Slot.WetGain = 0.0f;
+	Slot.SendGain = 1.0f;
+	Slot.TailFrames = static_cast<uint32_t>(pEffect->getTailTime() * SAMPLING_RATE);
+	Slot.SilentFrames = 0;
+	Slot.Tail = true;
+
+	// Effect DSP and parameters
+	pEffect->InitializeSlot(m_SerializeID, __ChainSlotMidiCC[NumSlot]);
+
+	// Slot parameters
+	Slot.OnOff.Init(1.0f, 0.0f, 0.0f, 1.0f, 1.0f, nullptr, 0, 0,
+	                CHAIN_MIDI_SLOT_ONOFF + 2 * NumSlot, m_SerializeID);
+	Slot.Mix.Init(50.0f, 0.0f, 100.0f, 5.0f, 1.0f, nullptr, 0, 0,
+	              CHAIN_MIDI_SLOT_MIX + 2 * NumSlot, m_SerializeID);
+
+	Slot.OnOffView.Init(&Slot.OnOff, ShortName, LongName);
+	Slot.OnOffView.AddDiscreteValue("Off", "Bypass");
+	Slot.OnOffView.AddDiscreteValue("On", "On");
+	Slot.OnOff.setValue(1.0f);				// Max is known once the views are added
+	Slot.MixView.Init(&Slot.Mix, "Mix", "Dry/Wet", "%", "%");
+	Slot.ItemSlotMenu.Init(&Slot.OnOffView, nullptr, &Slot.MixView);
+
+#ifdef MONITOR
+	Slot.Monitor.Init();
+#endif
+
+	if(TapTempo){
+		m_TapTempoSlot = NumSlot;
+	}
+	m_NbSlots++;
+	return true;
+}
+
+// --------------------------------------------------------------------------
+// Builds the menu and activates it
+void cEffectChainHost::StartChain(){
+	// Restore the active preset once every parameter is initialized
+	m_ItemMenuMemory.Init(m_SerializeID);
+	m_ItemInputVolume.Init();
+
+	// ---------------- Main Menu Configuration ----------------
+	m_Menu.Init();
+	m_Menu.addMenuItem(&m_ItemChainMenu, "Chain");
+	for(uint8_t NumSlot = 0; NumSlot < m_NbSlots; NumSlot++){
+		m_Menu.addMenuItem(&m_Slots[NumSlot].ItemSlotMenu, m_Slots[NumSlot].ShortName);
+		m_Slots[NumSlot].pEffect->AddMenuItems(m_Menu);
+	}
+	m_Menu.addMenuItem(&m_ItemMenuMemory, "Mem.");
+	m_Menu.addMenuItem(&m_ItemInputVolume, "Input");
+
+	// Sync with footswitch for tap-tempo
+	if(m_TapTempoSlot >= 0){
+		m_Slots[m_TapTempoSlot].pEffect->InitTapTempo(m_TapTempo);
+	}
+
+	// Activate the menu interface
+	DadUI::cPendaUI::setActiveObject(&m_Menu);
+
+	// ---------------- Volume Initialization ----------------
+	DadUI::cPendaUI::m_Volumes.MuteOff();
+}
+
+// --------------------------------------------------------------------------
+// Audio processing function (block of frames)
+void cEffectChainHost::Process(const AudioBlock &In, const AudioBlock &Out){
+	m_ItemInputVolume.Process(In);		// Input volume VU-Meter
+
+	const size_t nFrames = In.Size;
+	AudioBlock Src = In;				// Input of the current slot
+	bool OutWritten = false;			// Out holds the final block (global gain applied)
+	uint8_t NumBuffer = 0;
+
+	// Global mix gain (the analog dry path is mixed by cVolume)
+#ifdef PENDAI
+	const float GainOut = 1.0f;
+#elif defined(PENDAII)
+	const float GainOut = m_GainWet;
+#endif
+
+	for(uint8_t NumSlot = 0; NumSlot < m_NbSlots; NumSlot++){
+		sChainSlot &Slot = m_Slots[NumSlot];
+		const bool On = (Slot.OnOff != 0);
+
+		// Per-block slot gains: equal-power dry/wet, bypass crossfades to dry
+		// and keeps the wet part while the tail of the effect lasts
+		float DryTarget = 1.0f;
+		float WetTarget = 0.0f;
+		if(On || Slot.Tail){
+			if(Slot.Mix >= 100.0f){
+				DryTarget = 0.0f;
+				WetTarget = 1.0f;
+			}else{
+				float Mix = Slot.Mix * (0.01f * 0.5f * M_PI);
+				DryTarget = cosf(Mix);
+				WetTarget = sinf(Mix);
+			}
+			if(!On){
+				DryTarget = 1.0f;
+			}
+		}
+
+		// Fully bypassed slot, tail ended: the effect is not run
+		if((WetTarget == 0.0f) && (Slot.WetGain == 0.0f)){
+			Slot.DryGain = 1.0f;
+			continue;
+		}
+
+		// Effect input: faded out on bypass, faded in when switched on again
+		const float SendTarget = On ? 1.0f : 0.0f;
+		AudioBlock Send = Src;
+		if((SendTarget != 1.0f) || (Slot.SendGain != 1.0f)){
+			Send = __ChainSend.getBlock(nFrames);
+			SendBlock(Src, Send, Slot.SendGain, SendTarget);
+		}
+
+		// The last slot writes directly into Out
+		const bool Last = (NumSlot == m_NbSlots - 1);
+		AudioBlock Dst = Last ? Out : __ChainBuffer[NumBuffer].getBlock(nFrames);
+
+#ifdef MONITOR
+		Slot.Monitor.startMonitoring();
+#endif
+		Slot.pEffect->Process(Send, Dst);
+#ifdef MONITOR
+		Slot.Monitor.stopMonitoring();
+#endif
+		// The tail ends when the output of the silent input has stayed silent
+		// for longer than the tail time of the effect
+		if(On || (Slot.SendGain != 0.0f) || (PeakBlock(Dst) > CHAIN_TAIL_FLOOR)){
+			Slot.SilentFrames = 0;
+		}else{
+			Slot.SilentFrames += nFrames;
+		}
+		Slot.Tail = (Slot.SilentFrames <= Slot.TailFrames);
+		Slot.SendGain = SendTarget;
+
+		// The global gain is folded into the mix gains of the last slot
+		const float Gain = Last ? GainOut : 1.0f;
+		MixBlock(Src, Dst, Slot.DryGain * Gain, DryTarget * Gain,
+		         Slot.WetGain * Gain, WetTarget * Gain);
+		Slot.DryGain = DryTarget;
+		Slot.WetGain = WetTarget;
+
+		OutWritten = Last;
+		Src = Dst;
+		NumBuffer ^= 1;
+	}
+
+	// Last slot bypassed: copy the last block written with the global gain
+	if(!OutWritten){
+		for(size_t Index = 0; Index < nFrames; Index++){
+			Out.L(Index) = Src.L(Index) * GainOut;
+			Out.R(Index) = Src.R(Index) * GainOut;
+		}
+	}
+}
+
+// --------------------------------------------------------------------------
+// Copies In to Send with a gain ramped over the block
+void cEffectChainHost::SendBlock(const AudioBlock &In, const AudioBlock &Send, float GainStart, float GainEnd){
+	const float GainInc = (GainEnd - GainStart) / static_cast<float>(Send.Size);
+	float Gain = GainStart;
+	for(size_t Index = 0; Index < Send.Size; Index++){
+		Gain += GainInc;
+		Send.L(Index) = In.L(Index) * Gain;
+		Send.R(Index) = In.R(Index) * Gain;
+	}
+}
+
+// --------------------------------------------------------------------------
+// Peak level of a block
+float cEffectChainHost::PeakBlock(const AudioBlock &Block){
+	float Peak = 0.0f;
+	for(size_t Index = 0; Index < Block.Size; Index++){
+		Peak = std::max(Peak, std::max(std::fabs(Block.L(Index)), std::fabs(Block.R(Index))));
+	}
+	return Peak;
+}
+
+// --------------------------------------------------------------------------
+// Mixes the dry block into the wet block with gains ramped over the block
+void cEffectChainHost::MixBlock(const AudioBlock &Dry, const AudioBlock &Wet,
+                                float DryStart, float DryEnd, float WetStart, float WetEnd){
+	if((DryEnd == 0.0f) && (DryStart == 0.0f) && (WetStart == 1.0f) && (WetEnd == 1.0f)){
+		return;							// Fully wet, nothing to mix
+	}
+	const float InvSize = 1.0f / static_cast<float>(Wet.Size);
+	const float DryInc = (DryEnd - DryStart) * InvSize;
+	const float WetInc = (WetEnd - WetStart) * InvSize;
+	float DryGain = DryStart;
+	float WetGain = WetStart;
+	for(size_t Index = 0; Index < Wet.Size; Index++){
+		DryGain += DryInc;
+		WetGain += WetInc;
+		Wet.L(Index) = Dry.L(Index) * DryGain + Wet.L(Index) * WetGain;
+		Wet.R(Index) = Dry.R(Index) * DryGain + Wet.R(Index) * WetGain;
+	}
+}
+
+// --------------------------------------------------------------------------
+// Callback to update the global Mix parameter
+void cEffectChainHost::MixChange(DadUI::cParameter *pParameter, uintptr_t CallbackUserData){
+	cEffectChainHost *pthis = reinterpret_cast<cEffectChainHost *>(CallbackUserData);
+	pthis->m_GainWet = DadUI::cPendaUI::m_Volumes.MixDryWet(*pParameter);
+}
+
+} // namespace DadEffect
@@ -0,0 +1,208 @@
+//====================================================================================
+// EffectRegistry.cpp
+//
+// Hot-swappable effect registry
+//
+// Copyright(c) 2025 Dad Design.
+//====================================================================================
+
+#include "EffectRegistry.h"
+
+namespace DadEffect {
+
+//***********************************************************************************
+//  cEffectRegistry
+//***********************************************************************************
+
+// --------------------------------------------------------------------------
+// Prepares an empty registry
+void cEffectRegistry::InitRegistry(){
+	m_NbEffects = 0;
+	m_pEffect = nullptr;
+	m_State = eSwapState::Muted;
+	m_FadeGain = 0.0f;
+	m_FadeStep = 1.0f / (REGISTRY_FADE_TIME * SAMPLING_RATE);
+	m_MidiRequest = -1;
+
+	// Effect selection (saved apart from the presets of the effects)
+	m_Select.Init(0.0f, 0.0f, 0.0f, 1.0f, 1.0f, nullptr, 0, 0.0f, 0xFF, RegistrySerializeID);
+	m_SelectView.Init(&m_Select, "Effect", "Effect");
+	m_ItemSelectMenu.Init(nullptr, &m_SelectView, nullptr);
+
+	DadUI::cPendaUI::m_Midi.addProgramChangeCallback((uintptr_t) this, MIDI_ProgramChange_CallBack);
+}
+
+// --------------------------------------------------------------------------
+// Registers an effect
+bool cEffectRegistry::addEffect(const char *ShortName, const char *LongName, tEffectFactory Factory){
+	if(m_NbEffects >= REGISTRY_MAX_EFFECTS){
+		return false;
+	}
+	m_Effects[m_NbEffects] = {ShortName, LongName, Factory};
+	m_SelectView.AddDiscreteValue(ShortName, LongName);
+	m_NbEffects++;
+	return true;
+}
+
+// --------------------------------------------------------------------------
+// Restores the last selected effect and starts it
+void cEffectRegistry::StartRegistry(){
+	m_Select.setValue(0.0f);					// Max is known once the effects are added
+
+	uint32_t Size = __PersistentStorage.getSize(RegistrySerializeID);	// Get the size of the data
+	if (Size != 0) {
+		uint8_t* pBuffer = new uint8_t[Size]; 								// Allocate memory for the data
+		if (pBuffer != nullptr) {
+			uint32_t SizeLoad=0;
+			__PersistentStorage.Load(RegistrySerializeID, pBuffer, Size, SizeLoad); // Load data
+			if(SizeLoad != 0){
+				DadQSPI::cSerialize Serializer; 							// Create a serializer object
+				Serializer.setBuffer(pBuffer, Size); 						// Set the buffer with the restored data
+				DadUI::cPendaUI::Restore(Serializer, RegistrySerializeID);	// Deserialize and restore the state
+			}
+			delete[] pBuffer; 												// Free the allocated memory
+		}
+	}
+
+	m_Pending = static_cast<uint8_t>(m_Select.getTargetValue() + 0.5f);
+	m_PendingTime = HAL_GetTick();
+	StartEffect();
+}
+
+// --------------------------------------------------------------------------
+// Main loop processing: applies a pending selection
+void cEffectRegistry::Update(){
+	switch(m_State){
+	case eSwapState::Running: {
+		uint32_t Now = HAL_GetTick();
+
+		// MIDI Program Change: applied at once
+		int8_t MidiRequest = m_MidiRequest;
+		if(MidiRequest >= 0){
+			m_MidiRequest = -1;
+			m_Select.setValue(static_cast<float>(MidiRequest));
+			m_Pending = MidiRequest;
+			m_PendingTime = Now - REGISTRY_SELECT_DELAY;
+		}
+
+		// UI selection: applied once it has not changed for REGISTRY_SELECT_DELAY
+		uint8_t Selected = static_cast<uint8_t>(m_Select.getTargetValue() + 0.5f);
+		if(Selected != m_Pending){
+			m_Pending = Selected;
+			m_PendingTime = Now;
+		}
+		if((m_Pending != m_Current) && ((Now - m_PendingTime) >= REGISTRY_SELECT_DELAY)){
+			m_State = eSwapState::FadeOut;		// The audio thread mutes the output
+		}
+		break;
+	}
+	case eSwapState::Muted:
+		SwapEffect();
+		break;
+	default:
+		break;
+	}
+}
+
+// --------------------------------------------------------------------------
+// Replaces the running effect by m_Pending (output muted)
+void cEffectRegistry::SwapEffect(){
+	DadUI::cPendaUI::m_Volumes.MuteOn();
+
+	// The GUI objects of the effect are destroyed and created:
+	// no real-time processing of the user interface meanwhile
+	DadUI::cPendaUI::LockRTProcess(true);
+	DadUI::cPendaUI::ReleaseActiveObject();
+
+	if(m_pEffect != nullptr){
+		m_pEffect->~iEffect();
+		m_pEffect = nullptr;
+	}
+	__EffectArena.Reset();
+
+	StartEffect();
+
+	// Save the selection
+	DadQSPI::cSerialize Serializer; 										// Create a serializer object
+	DadUI::cPendaUI::Save(Serializer, RegistrySerializeID);					// Serialize the current state
+	const uint8_t* pBuffer = nullptr; 										// Pointer to the serialized data
+	uint32_t Size = Serializer.getBuffer(&pBuffer);							// Get the size of the serialized data
+	__PersistentStorage.Save(RegistrySerializeID, pBuffer, Size);
+
+	DadUI::cPendaUI::LockRTProcess(false);
+}
+
+// --------------------------------------------------------------------------
+// Creates and initializes the effect m_Pending
+void cEffectRegistry::StartEffect(){
+	if(m_Pending >= m_NbEffects){
+		m_Pending = 0;
+	}
+	m_Current = m_Pending;
+
+	// Standalone initialization: menu, presets, input volume (ends with MuteOff)
+	iEffect *pEffect = m_Effects[m_Current].Factory(__EffectArena);
+	pEffect->Initialize();
+
+	// Effect selection page at the end of the effect menu
+	DadUI::cUIMenu *pMenu = pEffect->getMenu();
+	if(pMenu != nullptr){
+		pMenu->addMenuItem(&m_ItemSelectMenu, "FX");
+		pMenu->drawTab();
+	}
+
+	m_pEffect = pEffect;
+	m_FadeGain = 0.0f;
+	m_State = eSwapState::FadeIn;
+}
+
+// --------------------------------------------------------------------------
+// Audio processing function (block of frames)
+void cEffectRegistry::Process(const AudioBlock &In, const AudioBlock &Out){
+	eSwapState State = m_State;
+
+	if(State == eSwapState::Muted){
+		for(size_t Index = 0; Index < Out.Size; Index++){
+			Out.L(Index) = 0.0f;
+			Out.R(Index) = 0.0f;
+		}
+		return;
+	}
+
+	m_pEffect->Process(In, Out);
+	if(State == eSwapState::Running){
+		return;
+	}
+
+	// Switch fades (linear, per frame)
+	float Gain = m_FadeGain;
+	const float Step = (State == eSwapState::FadeOut) ? -m_FadeStep : m_FadeStep;
+	for(size_t Index = 0; Index < Out.Size; Index++){
+		Gain += Step;
+		if(Gain < 0.0f){
+			Gain = 0.0f;
+		}else if(Gain > 1.0f){
+			Gain = 1.0f;
+		}
+		Out.L(Index) *= Gain;
+		Out.R(Index) *= Gain;
+	}
+	m_FadeGain = Gain;
+
+	if((State == eSwapState::FadeOut) && (Gain == 0.0f)){
+		m_State = eSwapState::Muted;			// The main loop can swap the effect
+	}else if((State == eSwapState::FadeIn) && (Gain == 1.0f)){
+		m_State = eSwapState::Running;
+	}
+}
+
+// --------------------------------------------------------------------------
+// MIDI Program Change: PC#REGISTRY_MIDI_PC_BASE + n selects effect n
+void cEffectRegistry::MIDI_ProgramChange_CallBack(uint8_t program, uintptr_t userData){
+	cEffectRegistry *pThis = (cEffectRegistry *)userData;
+	if((program >= REGISTRY_MIDI_PC_BASE) && (program < REGISTRY_MIDI_PC_BASE + pThis->m_NbEffects)){
+		pThis->m_MidiRequest = static_cast<int8_t>(program - REGISTRY_MIDI_PC_BASE);
+	}
+}
+
+} // namespace DadEffect
@@ -17,25 +17,15 @@ void cEffectTemplate::Initialize() {
 	m_GainWet = 0.0f;
 	DadUI::cPendaUI::m_Volumes.MuteOn();
 
-	// ---------------- Parameter Initialization ----------------
-	m_DryWetMix.Init(
-		50.0f, 0.0f, 100.0f, 5.0f, 1.0f,
-		MixChange, (uint32_t)this,
-		0.5f * UI_RT_SAMPLING_RATE, 20,
-		EffectTemplateSerializeID
-	);
-
-	// ---------------- View Setup ----------------
-	m_DryWetMixView.Init(&m_DryWetMix, "Mix", "Dry/Wet", "%", "%");
+	InitializeEffect(EffectTemplateSerializeID, 20, true);
 
-	// ---------------- Menu Grouping ----------------
-	m_ItemEffectMenu.Init(nullptr, nullptr, &m_DryWetMixView);
 	m_ItemMenuMemory.Init(EffectTemplateSerializeID);
 	m_ItemInputVolume.Init();
+	m_InputMeter = true;
 
 	// ---------------- Main Menu Configuration ----------------
 	m_Menu.Init();
-	m_Menu.addMenuItem(&m_ItemEffectMenu, "Main");
+	AddMenuItems(m_Menu);
 	m_Menu.addMenuItem(&m_ItemMenuMemory, "Mem.");
 	m_Menu.addMenuItem(&m_ItemInputVolume, "Input");
 
@@ -45,22 +35,63 @@ void cEffectTemplate::Initialize() {
 	DadUI::cPendaUI::m_Volumes.MuteOff();
 }
 
+// --------------------------------------------------------------------------
+// Initializes DSP modules and parameters for an effect chain slot
+// (dry/wet, memory and input volume are handled by the chain)
+void cEffectTemplate::InitializeSlot(uint32_t SerializeID, uint8_t MidiCCBase) {
+	m_GainWet = 1.0f;
+	m_InputMeter = false;
+	InitializeEffect(SerializeID, MidiCCBase, false);
+}
+
+// --------------------------------------------------------------------------
+// Initializes DSP modules, parameters, views and parameter groups
+void cEffectTemplate::InitializeEffect(uint32_t SerializeID, uint8_t MidiCCBase, bool WithMix) {
+	// ---------------- Parameter Initialization ----------------
+	if(WithMix){
+		m_DryWetMix.Init(
+			50.0f, 0.0f, 100.0f, 5.0f, 1.0f,
+			MixChange, (uintptr_t)this,
+			0.5f * UI_RT_SAMPLING_RATE, MidiCCBase,
+			SerializeID
+		);
+	}
+
+	// ---------------- View Setup ----------------
+	m_DryWetMixView.Init(&m_DryWetMix, "Mix", "Dry/Wet", "%", "%");
+
+	// ---------------- Menu Grouping ----------------
+	m_ItemEffectMenu.Init(nullptr, nullptr, WithMix ? &m_DryWetMixView : nullptr);
+}
+
+// --------------------------------------------------------------------------
+// Adds the effect parameter pages to a menu
+void cEffectTemplate::AddMenuItems(DadUI::cUIMenu &Menu) {
+	Menu.addMenuItem(&m_ItemEffectMenu, "Main");
+}
+
 // --------------------------------------------------------------------------
 // Audio processing routine (default passthrough with gain)
-void cEffectTemplate::Process(AudioBuffer *pIn, AudioBuffer *pOut, bool OnOff) {
-	m_ItemInputVolume.Process(pIn);  // Input volume and VU meter
+void cEffectTemplate::Process(const AudioBlock &In, const AudioBlock &Out) {
+	if(m_InputMeter){
+		m_ItemInputVolume.Process(In);  // Input volume and VU meter
+	}
+
+	// Per-block gain
 #ifdef PENDAI
-	pOut->Left = pIn->Left;
-	pOut->Right = pIn->Right;
+	const float Gain = 1.0f;
 #elif defined(PENDAII)
-	pOut->Left = pIn->Left * m_GainWet;
-	pOut->Right = pIn->Right * m_GainWet;
+	const float Gain = m_GainWet;
 #endif
+	for(size_t Index = 0; Index < In.Size; Index++){
+		Out.L(Index) = In.L(Index) * Gain;
+		Out.R(Index) = In.R(Index) * Gain;
+	}
 }
 
 // --------------------------------------------------------------------------
 // Callback to update the Dry/Wet mix gain
-void cEffectTemplate::MixChange(DadUI::cParameter *pParameter, uint32_t CallbackUserData) {
+void cEffectTemplate::MixChange(DadUI::cParameter *pParameter, uintptr_t CallbackUserData) {
 	cEffectTemplate *pthis = reinterpret_cast<cEffectTemplate *>(CallbackUserData);
 	pthis->m_GainWet = DadUI::cPendaUI::m_Volumes.MixDryWet(*pParameter);
 }
@@ -0,0 +1,27 @@
+//====================================================================================
+// MultiEffect.cpp
+//
+// Delay / Tremolo / EQ hot-swappable effect
+//
+// Copyright(c) 2025 Dad Design.
+//====================================================================================
+
+#include "MultiEffect.h"
+
+namespace DadEffect {
+
+//***********************************************************************************
+//  cMultiEffect
+//***********************************************************************************
+
+// --------------------------------------------------------------------------
+// Registers the effects and starts the last selected one
+void cMultiEffect::Initialize(){
+	InitRegistry();
+	addEffect<cDelay>("Delay", "Delay");
+	addEffect<cTremolo>("Trem.", "Tremolo");
+	addEffect<cParametricEQ>("EQ", "Parametric EQ");
+	StartRegistry();
+}
+
+} // namespace DadEffect
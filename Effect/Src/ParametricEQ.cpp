@@ -0,0 +1,226 @@
+//====================================================================================
+// ParametricEQ.cpp
+//
+// Parametric EQ Effect Module
+//
+// Copyright (c) 2025 Dad Design.
+//====================================================================================
+
+#include "ParametricEQ.h"
+
+// The parameters ramp at UI_RT_SAMPLING_RATE: the section coefficients are
+// calculated at most EQ_CONTROL_RATE times per second and interpolated
+constexpr float EQ_CONTROL_RATE = 1000.0f;
+
+constexpr float EQ_GAIN_RANGE = 15.0f;		// Band gains: +/- 15 dB
+constexpr float EQ_CUT_BANDWIDTH = 1.9f;	// Low / high cut: Q = 0.707 (Butterworth)
+constexpr float EQ_SHELF_BANDWIDTH = 1.0f;	// Unused by the shelf formulae
+
+// Sections of the cascade
+enum eEQSection : uint8_t {
+	LowCutSection = 0,
+	LowSection,
+	MidSection,										// EQ_NB_MID_BANDS sections
+	HighSection = MidSection + DadEffect::EQ_NB_MID_BANDS,
+	HighCutSection
+};
+
+// Peaking bands: default, minimum and maximum frequencies (Hz)
+static constexpr float __MidFreq[DadEffect::EQ_NB_MID_BANDS][3] = {
+	{ 250.0f,  100.0f,  1000.0f},
+	{1000.0f,  300.0f,  3000.0f},
+	{3000.0f, 1000.0f, 10000.0f}
+};
+
+namespace DadEffect {
+
+//***********************************************************************************
+//  cParametricEQ - Class handling the EQ parameters, audio processing,
+//                  and user interface integration.
+//***********************************************************************************
+
+// --------------------------------------------------------------------------
+// Initializes UI parameters, filters and menu interface
+void cParametricEQ::Initialize(){
+	// ---------------- Volume Initialization ----------------
+	DadUI::cPendaUI::m_Volumes.BypassModeChange(DadMisc::eDryWetMode::DryAuto);
+	DadUI::cPendaUI::m_Volumes.MuteOn();
+	m_GainWet = 0;
+
+	InitializeEffect(ParametricEQSerializeID, 20, true);
+
+	m_ItemMenuMemory.Init(ParametricEQSerializeID);
+	m_ItemInputVolume.Init();
+	m_InputMeter = true;
+
+	// ---------------- Main Menu Configuration ----------------
+	m_Menu.Init();
+	AddMenuItems(m_Menu);
+	m_Menu.addMenuItem(&m_ItemMixMenu, "Mix");
+	m_Menu.addMenuItem(&m_ItemMenuMemory, "Mem.");
+	m_Menu.addMenuItem(&m_ItemInputVolume, "Input");
+
+	// Activate the menu interface
+	DadUI::cPendaUI::setActiveObject(&m_Menu);
+
+	// ---------------- Volume Initialization ----------------
+	DadUI::cPendaUI::m_Volumes.MuteOff();
+}
+
+// --------------------------------------------------------------------------
+// Initializes DSP modules and parameters for an effect chain slot
+// (dry/wet, memory and input volume are handled by the chain)
+void cParametricEQ::InitializeSlot(uint32_t SerializeID, uint8_t MidiCCBase){
+	m_GainWet = 1.0f;
+	m_InputMeter = false;
+	InitializeEffect(SerializeID, MidiCCBase, false);
+}
+
+// --------------------------------------------------------------------------
+// Initializes DSP modules, parameters, views and parameter groups
+void cParametricEQ::InitializeEffect(uint32_t SerializeID, uint8_t MidiCCBase, bool WithMix){
+	// ---------------- Filter Initialization ----------------
+	m_EQ.Initialize(SAMPLING_RATE);
+	m_EQ.addSection(20.0f, 0.0f, EQ_CUT_BANDWIDTH, DadDSP::FilterType::HPF);
+	m_EQ.addSection(100.0f, 0.0f, EQ_SHELF_BANDWIDTH, DadDSP::FilterType::LSH);
+	for(uint8_t Band = 0; Band < EQ_NB_MID_BANDS; Band++){
+		m_EQ.addSection(__MidFreq[Band][0], 0.0f, 1.0f, DadDSP::FilterType::PEQ);
+	}
+	m_EQ.addSection(6000.0f, 0.0f, EQ_SHELF_BANDWIDTH, DadDSP::FilterType::HSH);
+	m_EQ.addSection(20000.0f, 0.0f, EQ_CUT_BANDWIDTH, DadDSP::FilterType::LPF);
+	m_EQ.setControlRate(EQ_CONTROL_RATE);
+
+	// ---------------- Parameter Initialization ----------------
+	const float Slope = 0.2f * UI_RT_SAMPLING_RATE;
+
+	// Low cut and low shelf
+	m_LowCut.Init(20.0f, 20.0f, 400.0f, 10.0f, 1.0f, EQChange, (uintptr_t)this,
+	              Slope, MidiCCBase, SerializeID);
+	m_LowFreq.Init(100.0f, 40.0f, 500.0f, 10.0f, 1.0f, EQChange, (uintptr_t)this,
+	               Slope, MidiCCBase + 1, SerializeID);
+	m_LowGain.Init(0.0f, -EQ_GAIN_RANGE, EQ_GAIN_RANGE, 1.0f, 0.5f, EQChange, (uintptr_t)this,
+	               Slope, MidiCCBase + 2, SerializeID);
+
+	// Peaking bands
+	for(uint8_t Band = 0; Band < EQ_NB_MID_BANDS; Band++){
+		const float FreqStep = __MidFreq[Band][1] / 10.0f;
+		m_MidFreq[Band].Init(__MidFreq[Band][0], __MidFreq[Band][1], __MidFreq[Band][2], 5.0f * FreqStep, FreqStep,
+		                     EQChange, (uintptr_t)this, Slope, MidiCCBase + 3 + (3 * Band), SerializeID);
+		m_MidGain[Band].Init(0.0f, -EQ_GAIN_RANGE, EQ_GAIN_RANGE, 1.0f, 0.5f, EQChange, (uintptr_t)this,
+		                     Slope, MidiCCBase + 4 + (3 * Band), SerializeID);
+		m_MidWidth[Band].Init(1.0f, 0.2f, 3.0f, 0.2f, 0.1f, EQChange, (uintptr_t)this,
+		                      Slope, MidiCCBase + 5 + (3 * Band), SerializeID);
+	}
+
+	// High shelf and high cut
+	m_HighFreq.Init(6000.0f, 2000.0f, 16000.0f, 500.0f, 100.0f, EQChange, (uintptr_t)this,
+	                Slope, MidiCCBase + 12, SerializeID);
+	m_HighGain.Init(0.0f, -EQ_GAIN_RANGE, EQ_GAIN_RANGE, 1.0f, 0.5f, EQChange, (uintptr_t)this,
+	                Slope, MidiCCBase + 13, SerializeID);
+	m_HighCut.Init(20000.0f, 2000.0f, 20000.0f, 1000.0f, 100.0f, EQChange, (uintptr_t)this,
+	               Slope, MidiCCBase + 14, SerializeID);
+
+	// Dry/Wet Mix
+	if(WithMix){
+		m_DryWetMix.Init(100.0f, 0.0f, 100.0f, 5.0f, 1.0f, MixChange, (uintptr_t)this,
+		                 0, MidiCCBase + 15, SerializeID);
+	}
+
+	// ---------------- View Setup ----------------
+	m_LowCutView.Init(&m_LowCut, "Cut", "Low Cut", "Hz", "Hz");
+	m_LowFreqView.Init(&m_LowFreq, "Freq", "Low Freq.", "Hz", "Hz");
+	m_LowGainView.Init(&m_LowGain, "Gain", "Low Gain", "dB", "dB");
+	for(uint8_t Band = 0; Band < EQ_NB_MID_BANDS; Band++){
+		m_MidFreqView[Band].Init(&m_MidFreq[Band], "Freq", "Frequency", "Hz", "Hz");
+		m_MidGainView[Band].Init(&m_MidGain[Band], "Gain", "Gain", "dB", "dB");
+		m_MidWidthView[Band].Init(&m_MidWidth[Band], "Width", "Width", "oct", "octave");
+	}
+	m_HighFreqView.Init(&m_HighFreq, "Freq", "High Freq.", "Hz", "Hz");
+	m_HighGainView.Init(&m_HighGain, "Gain", "High Gain", "dB", "dB");
+	m_HighCutView.Init(&m_HighCut, "Cut", "High Cut", "Hz", "Hz");
+	m_DryWetMixView.Init(&m_DryWetMix, "Mix", "Dry/Wet", "%", "%");
+
+	// ---------------- Menu Grouping ----------------
+	m_ResponseView.Init(ResponseCallback, (uintptr_t)this, 20.0f, 20000.0f, EQ_GAIN_RANGE);
+	m_ItemLowMenu.Init(&m_LowCutView, &m_LowFreqView, &m_LowGainView, &m_ResponseView);
+	for(uint8_t Band = 0; Band < EQ_NB_MID_BANDS; Band++){
+		m_ItemMidMenu[Band].Init(&m_MidFreqView[Band], &m_MidGainView[Band], &m_MidWidthView[Band], &m_ResponseView);
+	}
+	m_ItemHighMenu.Init(&m_HighFreqView, &m_HighGainView, &m_HighCutView, &m_ResponseView);
+	m_ItemMixMenu.Init(nullptr, nullptr, WithMix ? &m_DryWetMixView : nullptr);
+
+	EQChange(nullptr, (uintptr_t)this);
+}
+
+// --------------------------------------------------------------------------
+// Adds the EQ parameter pages to a menu
+void cParametricEQ::AddMenuItems(DadUI::cUIMenu &Menu){
+	Menu.addMenuItem(&m_ItemLowMenu, "Low");
+	Menu.addMenuItem(&m_ItemMidMenu[0], "Mid1");
+	Menu.addMenuItem(&m_ItemMidMenu[1], "Mid2");
+	Menu.addMenuItem(&m_ItemMidMenu[2], "Mid3");
+	Menu.addMenuItem(&m_ItemHighMenu, "High");
+}
+
+// --------------------------------------------------------------------------
+// Audio processing routine (block of frames)
+void cParametricEQ::Process(const AudioBlock &In, const AudioBlock &Out){
+	if(m_InputMeter){
+		m_ItemInputVolume.Process(In);	// Input volume VU-Meter
+	}
+
+	m_EQ.Process(In, Out);
+
+#ifdef PENDAII
+	const float Gain = m_GainWet;
+	for(size_t Index = 0; Index < Out.Size; Index++){
+		Out.L(Index) *= Gain;
+		Out.R(Index) *= Gain;
+	}
+#endif
+}
+
+// --------------------------------------------------------------------------
+// Callback of every EQ parameter: updates the sections and the response curve
+// Called on every ramp step (up to UI_RT_SAMPLING_RATE times per second): the
+// sections only record their parameters, the coefficients are calculated at
+// EQ_CONTROL_RATE and interpolated block by block.
+void cParametricEQ::EQChange(DadUI::cParameter *pParameter, uintptr_t CallbackUserData){
+	cParametricEQ *pthis = reinterpret_cast<cParametricEQ *>(CallbackUserData);
+	DadDSP::cBiQuadCascade &EQ = pthis->m_EQ;
+
+	EQ.getSection(LowCutSection).setCutoffFreq(pthis->m_LowCut);
+	EQ.getSection(LowSection).setCutoffFreq(pthis->m_LowFreq);
+	EQ.getSection(LowSection).setGainDb(pthis->m_LowGain);
+	for(uint8_t Band = 0; Band < EQ_NB_MID_BANDS; Band++){
+		DadDSP::cBiQuad &Section = EQ.getSection(MidSection + Band);
+		Section.setCutoffFreq(pthis->m_MidFreq[Band]);
+		Section.setGainDb(pthis->m_MidGain[Band]);
+		Section.setBandwidth(pthis->m_MidWidth[Band]);
+	}
+	EQ.getSection(HighSection).setCutoffFreq(pthis->m_HighFreq);
+	EQ.getSection(HighSection).setGainDb(pthis->m_HighGain);
+	EQ.getSection(HighCutSection).setCutoffFreq(pthis->m_HighCut);
+
+	for(uint8_t Section = 0; Section < EQ.getNbSections(); Section++){
+		EQ.getSection(Section).UpdateParameters();
+	}
+	pthis->m_ResponseView.setDirty();
+}
+
+// --------------------------------------------------------------------------
+// Callback to update the Dry/Wet mix gain
+void cParametricEQ::MixChange(DadUI::cParameter *pParameter, uintptr_t CallbackUserData){
+	cParametricEQ *pthis = reinterpret_cast<cParametricEQ *>(CallbackUserData);
+	pthis->m_GainWet = DadUI::cPendaUI::m_Volumes.MixDryWet(*pParameter);
+}
+
+// --------------------------------------------------------------------------
+// Response curve: gains of the cascade (parameters being set, not the
+// interpolated coefficients)
+void cParametricEQ::ResponseCallback(const float *pFreq, float *pGainDb, size_t Count, uintptr_t CallbackUserData){
+	cParametricEQ *pthis = reinterpret_cast<cParametricEQ *>(CallbackUserData);
+	pthis->m_EQ.GainDb(pFreq, pGainDb, Count);
+}
+
+} // namespace DadEffect
@@ -7,6 +7,7 @@
 //====================================================================================
 
 #include "Tremolo.h"
+#include "FastMath.h"
 
 constexpr float DELAY_MAX_TIME = 0.02f; // Maximum modulation delay time in seconds
 constexpr float FREQ_MIN = 0.5f;        // Minimum LFO frequency in Hz
@@ -20,12 +21,57 @@ constexpr uint32_t ceil_to_uint(float value) {
 // Compute delay buffer size based on the sampling rate and max delay time
 constexpr uint32_t DELAY_BUFFER_SIZE = ceil_to_uint(SAMPLING_RATE * DELAY_MAX_TIME);
 
-// Allocate modulation delay buffers in external SDRAM (+100 samples for safe interpolation)
-SDRAM_SECTION float __ModulationBufferLeft[DELAY_BUFFER_SIZE + 100];
-SDRAM_SECTION float __ModulationBufferRight[DELAY_BUFFER_SIZE + 100];
+// Modulation delay buffers are allocated in the SDRAM effect arena
+// (power of two capacity, +100 samples for safe interpolation)
+constexpr uint32_t DELAY_BUFFER_ALLOC = DadEffect::tModulationLine::getCapacity(DELAY_BUFFER_SIZE + 100);
+
+// Gain curve of the triangle LFO: sin(1 - (x * pi/2)) at x = 1 - (Index / TREMOLO_GAIN_SIZE),
+// plus a guard point (built at compile time)
+struct sTremoloGainTable {
+	float Value[DadEffect::TREMOLO_GAIN_SIZE + 2];
+};
+
+constexpr sTremoloGainTable MakeTremoloGainTable() {
+	constexpr double HALF_PI = 1.57079632679489661923;
+	sTremoloGainTable Table = {};
+	for (uint32_t Index = 0; Index < DadEffect::TREMOLO_GAIN_SIZE + 2; Index++) {
+		double x = 1.0 - (static_cast<double>(Index) / DadEffect::TREMOLO_GAIN_SIZE);
+		Table.Value[Index] = static_cast<float>(DadDSP::DCOSine(1.0 - (x * HALF_PI)));
+	}
+	return Table;
+}
+
+constexpr sTremoloGainTable __TremoloGainTable = MakeTremoloGainTable();
 
 namespace DadEffect {
 
+//***********************************************************************************
+//  cTremoloGain - Volume modulation of the tremolo
+//***********************************************************************************
+
+// --------------------------------------------------------------------------
+// Sets the depth (0 to 100 %): D and the affine map of the LFO values
+void cTremoloGain::setDepth(float Depth){
+	m_Deep = DadDSP::FastSin((Depth / 100.0f) * M_PI / 2.0f);
+	m_Offset = 1.0f - m_Deep;
+	m_CurveOffset = m_Offset * TREMOLO_GAIN_SIZE;
+	m_CurveScale = m_Deep * TREMOLO_GAIN_SIZE;
+}
+
+// --------------------------------------------------------------------------
+// Triangle: position in the table (0 to TREMOLO_GAIN_SIZE), linear interpolation
+void cTremoloGain::Triangle(const float *pLFO, float *pGain, size_t Size) const{
+	constexpr float MaxPosition = static_cast<float>(TREMOLO_GAIN_SIZE);
+	for(size_t Index = 0; Index < Size; Index++){
+		float Position = m_CurveOffset + (m_CurveScale * pLFO[Index]);
+		Position = (Position < 0.0f) ? 0.0f : ((Position > MaxPosition) ? MaxPosition : Position);
+		const uint32_t Point = static_cast<uint32_t>(Position);
+		const float Frac = Position - static_cast<float>(Point);
+		const float Value = __TremoloGainTable.Value[Point];
+		pGain[Index] = Value + ((__TremoloGainTable.Value[Point + 1] - Value) * Frac);
+	}
+}
+
 //***********************************************************************************
 //  cTremolo - Class handling the tremolo effect parameters, audio processing,
 //             and user interface integration.
@@ -39,35 +85,72 @@ void cTremolo::Initialize(){
 	DadUI::cPendaUI::m_Volumes.MuteOn();
 	m_GainWet = 0;
 
+	InitializeEffect(TremoloSerializeID, 20, true);
+
+	m_ItemMenuMemory.Init(TremoloSerializeID);
+	m_ItemInputVolume.Init();
+	m_InputMeter = true;
+
+	// ---------------- Main Menu Configuration ----------------
+	m_Menu.Init();
+	AddMenuItems(m_Menu);
+	m_Menu.addMenuItem(&m_ItemMenuMemory, "Mem.");
+	m_Menu.addMenuItem(&m_ItemInputVolume, "Input");
+
+	// Sync with footswitch for tap-tempo
+	InitTapTempo(m_TapTempo);
+
+	// Activate the menu interface
+	DadUI::cPendaUI::setActiveObject(&m_Menu);
+
+	// ---------------- Volume Initialization ----------------
+	DadUI::cPendaUI::m_Volumes.MuteOff();
+}
+
+// --------------------------------------------------------------------------
+// Initializes DSP modules and parameters for an effect chain slot
+// (dry/wet, memory and input volume are handled by the chain)
+void cTremolo::InitializeSlot(uint32_t SerializeID, uint8_t MidiCCBase){
+	m_GainWet = 1.0f;
+	m_InputMeter = false;
+	InitializeEffect(SerializeID, MidiCCBase, false);
+}
+
+// --------------------------------------------------------------------------
+// Initializes DSP modules, parameters, views and parameter groups
+void cTremolo::InitializeEffect(uint32_t SerializeID, uint8_t MidiCCBase, bool WithMix){
 	// ---------------- Parameter Initialization ----------------
 
 	// LFO Frequency
-	m_Freq.Init(5.0f, FREQ_MIN, FREQ_MAX, 0.5f, 0.1f, SpeedChange, (uint32_t)this,
-	            5.0f * UI_RT_SAMPLING_RATE, 20, TremoloSerializeID);
+	m_Freq.Init(5.0f, FREQ_MIN, FREQ_MAX, 0.5f, 0.1f, SpeedChange, (uintptr_t)this,
+	            5.0f * UI_RT_SAMPLING_RATE, MidiCCBase, SerializeID);
 
 	// Tremolo Depth
-	m_TremoloDeep.Init(45.0f, 0.0f, 100.0f, 5.0f, 1.0f, nullptr, 0,
-	                   0.5f * UI_RT_SAMPLING_RATE, 21, TremoloSerializeID);
+	m_TremoloDeep.Init(45.0f, 0.0f, 100.0f, 5.0f, 1.0f, DeepChange, (uintptr_t)this,
+	                   0.5f * UI_RT_SAMPLING_RATE, MidiCCBase + 1, SerializeID);
+	m_Gain.setDepth(m_TremoloDeep);
 	// Dry/Wet Mix
 #ifdef PENDAII
-	m_DryWetMix.Init(45.0f, 0.0f, 100.0f, 5.0f, 1.0f, MixChange, (uint32_t)this,
-	                   0, 22, TremoloSerializeID);
+	if(WithMix){
+		m_DryWetMix.Init(45.0f, 0.0f, 100.0f, 5.0f, 1.0f, MixChange, (uintptr_t)this,
+		                   0, MidiCCBase + 2, SerializeID);
+	}
 #endif
 
 	// Vibrato Depth (used for delay-based pitch modulation)
 	m_VibratoDeep.Init(0.0f, 0.0f, 100.0f, 5.0f, 1.0f, nullptr, 0,
-	                   0.5f * UI_RT_SAMPLING_RATE, 23, TremoloSerializeID);
+	                   0.5f * UI_RT_SAMPLING_RATE, MidiCCBase + 3, SerializeID);
 
 	// LFO Shape (0: Triangle, 1: Square)
 	m_LFOShape.Init(0.0f, 0.0f, 0.0f, 1.0f, 1.0f, nullptr, 0,
-	                0.0f, 24, TremoloSerializeID);
+	                0.0f, MidiCCBase + 4, SerializeID);
 
 	// LFO Duty Cycle Ratio
-	m_LFORatio.Init(50.0f, 0.0f, 100.0f, 5.0f, 1.0f, RatioChange, (uint32_t)this,
-	                0.5f * UI_RT_SAMPLING_RATE, 25, TremoloSerializeID);
+	m_LFORatio.Init(50.0f, 0.0f, 100.0f, 5.0f, 1.0f, RatioChange, (uintptr_t)this,
+	                0.5f * UI_RT_SAMPLING_RATE, MidiCCBase + 5, SerializeID);
 
 	// Stereo mode
-	m_StereoMode.Init(0.0f, 0.0f, 0.0f, 1.0f, 1.0f, nullptr, 0, 0.0f, 26, TremoloSerializeID);
+	m_StereoMode.Init(0.0f, 0.0f, 0.0f, 1.0f, 1.0f, nullptr, 0, 0.0f, MidiCCBase + 6, SerializeID);
 
 
 	// ---------------- View Setup ----------------
@@ -86,107 +169,157 @@ void cTremolo::Initialize(){
 	m_StereoModeView.AddDiscreteValue("Both", "Both St.");
 
 	// ---------------- Menu Grouping ----------------
-	m_ItemTremoloMenu.Init(&m_TremoloDeepView, &m_VibratoDeepView, &m_DryWetMixView);
+	m_ItemTremoloMenu.Init(&m_TremoloDeepView, &m_VibratoDeepView, WithMix ? &m_DryWetMixView : nullptr);
 	m_ItemLFOMenu.Init(&m_LFOShapeView, &m_LFORatioView, &m_FreqView);
 	m_ItemStereoMode.Init(&m_StereoModeView, nullptr, nullptr);
-	m_ItemMenuMemory.Init(TremoloSerializeID);
-	m_ItemInputVolume.Init();
-
-	// ---------------- Main Menu Configuration ----------------
-	m_Menu.Init();
-	m_Menu.addMenuItem(&m_ItemTremoloMenu, "Main");
-	m_Menu.addMenuItem(&m_ItemLFOMenu, "LFO");
-	m_Menu.addMenuItem(&m_ItemStereoMode, "Stereo");
-	m_Menu.addMenuItem(&m_ItemMenuMemory, "Mem.");
-	m_Menu.addMenuItem(&m_ItemInputVolume, "Input");
-
-	// Sync with footswitch for tap-tempo
-	m_TapTempo.Init(&DadUI::cPendaUI::m_FootSwitch2, &m_FreqView, DadUI::eTempoType::frequency);
-
-	// Activate the menu interface
-	DadUI::cPendaUI::setActiveObject(&m_Menu);
 
 	// ---------------- LFO and Delay Buffer Initialization ----------------
-	m_LFOLeft.Initialize(SAMPLING_RATE, m_Freq, 1, 10, m_LFORatio.getNormalizedValue());
-	m_LFORight.Initialize(SAMPLING_RATE, m_Freq, 1, 10, m_LFORatio.getNormalizedValue());
-	m_LFORight.setPosition(0.5f);
+	m_LFO.Initialize(SAMPLING_RATE, m_Freq, 1, 10, m_LFORatio.getNormalizedValue());
+	m_LFO.setPosition(LFO_RIGHT, 0.5f);
 
-	m_ModulationLineRight.Initialize(__ModulationBufferRight, DELAY_BUFFER_SIZE);
+	m_ModulationLineRight.Initialize(__EffectArena.AllocateArray<float>(DELAY_BUFFER_ALLOC), DELAY_BUFFER_ALLOC);
 	m_ModulationLineRight.Clear();
 
-	m_ModulationLineLeft.Initialize(__ModulationBufferLeft, DELAY_BUFFER_SIZE);
+	m_ModulationLineLeft.Initialize(__EffectArena.AllocateArray<float>(DELAY_BUFFER_ALLOC), DELAY_BUFFER_ALLOC);
 	m_ModulationLineLeft.Clear();
+}
 
-	// ---------------- Volume Initialization ----------------
-	DadUI::cPendaUI::m_Volumes.MuteOff();
+// --------------------------------------------------------------------------
+// Adds the tremolo parameter pages to a menu
+void cTremolo::AddMenuItems(DadUI::cUIMenu &Menu){
+	Menu.addMenuItem(&m_ItemTremoloMenu, "Main");
+	Menu.addMenuItem(&m_ItemLFOMenu, "LFO");
+	Menu.addMenuItem(&m_ItemStereoMode, "Stereo");
+}
+
+// --------------------------------------------------------------------------
+// Connects tap tempo (footswitch 2) to the LFO frequency
+void cTremolo::InitTapTempo(DadUI::cTapTempo &TapTempo){
+	TapTempo.Init(&DadUI::cPendaUI::m_FootSwitch2, &m_FreqView, DadUI::eTempoType::frequency);
+}
+
+// --------------------------------------------------------------------------
+// Steps the LFOs over a block: vibrato delays and LFO values of every frame
+// (square: the volume modulation itself)
+template<bool Square, bool StereoVibrato>
+void cTremolo::StepLFO(size_t Size, float BlockDelay, float VibratoScale,
+					   AudioPlanarBuffer<AUDIO_BUFFER_SIZE_MAX> &Delays, AudioPlanarBuffer<AUDIO_BUFFER_SIZE_MAX> &LFO){
+	for(size_t Index = 0; Index < Size; Index++){
+		float Shapes[LFO_COUNT];
+		float Sines[LFO_COUNT];
+		m_LFO.StepSineValues(Sines); // Update LFO phases
+		if(Square){
+			m_LFO.getSquareModValues(Shapes);
+			LFO.Left[Index]  = m_Gain.Square(Shapes[LFO_LEFT]);
+			LFO.Right[Index] = m_Gain.Square(Shapes[LFO_RIGHT]);
+		}else{
+			m_LFO.getTriangleModValues(Shapes);
+			LFO.Left[Index]  = Shapes[LFO_LEFT];
+			LFO.Right[Index] = Shapes[LFO_RIGHT];
+		}
+
+		// Compute vibrato delay in samples (from the smallest delay of the
+		// interpolator: it reads one sample newer than the delay).
+		Delays.Left[Index]  = BlockDelay + (VibratoScale * Sines[LFO_LEFT]);
+		Delays.Right[Index] = StereoVibrato ? BlockDelay + (VibratoScale * Sines[LFO_RIGHT]) : Delays.Left[Index];
+	}
 }
 
 // --------------------------------------------------------------------------
 // Audio processing routine: applies volume and pitch modulation
-void cTremolo::Process(AudioBuffer *pIn, AudioBuffer *pOut, bool OnOff){
-	m_LFOLeft.Step(); // Update LFO phase
-	m_LFORight.Step();
-	m_ItemInputVolume.Process(pIn);		// Input volume VU-Meter
-
-	float VolumeModulationLeft = 0.0f;
-	float VolumeModulationRight = 0.0f;
-	float TremoloDeep = sinf((m_TremoloDeep / 100.0f) * M_PI / 2.0f);
-	//float TremoloDeep = (m_TremoloDeep / 100.0f);
-	switch(static_cast<uint32_t>(m_LFOShape.getValue())){
-		case 0:
-			if((m_StereoMode == 0) || (m_StereoMode == 2)){
-				VolumeModulationLeft = sinf(1 - ((TremoloDeep)*(1-m_LFOLeft.getTriangleModValue()))* M_PI / 2.0f);
-				VolumeModulationRight = VolumeModulationLeft;
-			}else if((m_StereoMode == 1) || (m_StereoMode == 3)){
-				VolumeModulationLeft = sinf(1 - ((TremoloDeep)*(1-m_LFOLeft.getTriangleModValue()))* M_PI / 2.0f);
-				VolumeModulationRight = sinf(1 - ((TremoloDeep)*(1-m_LFORight.getTriangleModValue()))* M_PI / 2.0f);
-			}
-			break;
-		case 1:
-			if((m_StereoMode == 0) || (m_StereoMode == 2)){
-				VolumeModulationLeft = 1 - ((TremoloDeep)*(1-m_LFOLeft.getSquareModValue()));
-				VolumeModulationRight = VolumeModulationLeft;
-			}else if((m_StereoMode == 1) || (m_StereoMode == 3)){
-				VolumeModulationLeft = 1 - ((TremoloDeep)*(1-m_LFOLeft.getSquareModValue()));
-				VolumeModulationRight = 1 - ((TremoloDeep)*(1-m_LFORight.getSquareModValue()));
-			}
-			break;
+// (block of frames)
+void cTremolo::Process(const AudioBlock &In, const AudioBlock &Out){
+	if(m_InputMeter){
+		m_ItemInputVolume.Process(In);	// Input volume VU-Meter
+	}
+
+	// Per-block values ---------------------------------------------------------
+	// Parameters only change in cPendaUI::RTProcess(), called once per block
+	// before the effect: shape and stereo mode select the kernels of the block
+	// here, the depth constants are updated by DeepChange().
+	const bool Square = (static_cast<uint32_t>(m_LFOShape.getValue()) == 1);
+#ifdef PENDAI
+	// PENDAI: both channels follow the left modulation
+	constexpr bool StereoTremolo = false;
+	constexpr bool StereoVibrato = false;
+#elif defined(PENDAII)
+	const bool StereoTremolo = (m_StereoMode == 1) || (m_StereoMode == 3);
+	const bool StereoVibrato = (m_StereoMode == 2) || (m_StereoMode == 3);
+#endif
+
+	// Vibrato delay scale: the delay is modulated by the LFO sine wave, scaled by the
+	// user-defined depth, and adjusted with a compensation factor to keep the vibrato
+	// range independent of LFO frequency.
+	const float VibratoScale = DELAY_BUFFER_SIZE * m_CoefComp * (m_VibratoDeep/100) * 0.5f;
+	constexpr float VibratoDelay = static_cast<float>(tModulationLine::kMinDelay);
+#ifdef PENDAII
+	const float Gain = m_GainWet * 1.2f;
+#endif
+
+	// Vibrato delays and LFO values of every frame ------------------------------
+	// The block is written to the modulation lines before it is read: the
+	// delay of frame Index is counted from the last frame of the block
+	// (cBlockDelayLine::Read), hence the In.Size - 1 added to every delay.
+	AudioPlanarBuffer<AUDIO_BUFFER_SIZE_MAX> Dry;
+	AudioPlanarBuffer<AUDIO_BUFFER_SIZE_MAX> Delays;	// Vibrato delays (samples)
+	AudioPlanarBuffer<AUDIO_BUFFER_SIZE_MAX> Volume;	// LFO values, then volume modulation
+	const float BlockDelay = VibratoDelay + static_cast<float>(In.Size - 1);
+
+	if(Square){
+		if(StereoVibrato){
+			StepLFO<true, true>(In.Size, BlockDelay, VibratoScale, Delays, Volume);
+		}else{
+			StepLFO<true, false>(In.Size, BlockDelay, VibratoScale, Delays, Volume);
+		}
+	}else{
+		if(StereoVibrato){
+			StepLFO<false, true>(In.Size, BlockDelay, VibratoScale, Delays, Volume);
+		}else{
+			StepLFO<false, false>(In.Size, BlockDelay, VibratoScale, Delays, Volume);
+		}
 	}
 
-	// Compute vibrato delay in samples.
-	// The delay is modulated by the LFO sine wave, scaled by the user-defined depth,
-	// and adjusted with a compensation factor to keep the vibrato range independent of LFO frequency.
-	float LFOSinLeft = m_LFOLeft.getSineValue();
-	float LFOSinRight = m_LFORight.getSineValue();
-	float DelayLeft = 0.0f;
-	float DelayRight = 0.0f;
-
-	if((m_StereoMode == 0) || (m_StereoMode == 1)){
-		DelayLeft = DELAY_BUFFER_SIZE * LFOSinLeft * m_CoefComp * (m_VibratoDeep/100)  * 0.5f;
-		DelayRight = DelayLeft;
-	}else if((m_StereoMode == 2) || (m_StereoMode == 3)){
-		DelayLeft = DELAY_BUFFER_SIZE * LFOSinLeft * m_CoefComp * (m_VibratoDeep/100)  * 0.5f;
-		DelayRight = DELAY_BUFFER_SIZE * LFOSinRight * m_CoefComp * (m_VibratoDeep/100)  * 0.5f;
+	// Volume modulation of the block (triangle: in place, square: done by
+	// StepLFO; the right channel follows the left one without stereo tremolo).
+	// Volume is filled for the In.Size frames by StepLFO: GCC does not see it
+	// when the step is not inlined.
+	const float *pVolumeRight = StereoTremolo ? Volume.Right : Volume.Left;
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+	if(!Square){
+		m_Gain.Triangle(Volume.Left, Volume.Left, In.Size);
+		if(StereoTremolo){
+			m_Gain.Triangle(Volume.Right, Volume.Right, In.Size);
+		}
 	}
+#pragma GCC diagnostic pop
 
-	// Push current samples to delay line and read modulated delayed output
-	m_ModulationLineLeft.Push(pIn->Left);
-	m_ModulationLineRight.Push(pIn->Right);
+	// Modulation lines: the block in, the modulated delays out ---------------------
+	for(size_t Index = 0; Index < In.Size; Index++){
+		Dry.Left[Index]  = In.L(Index);
+		Dry.Right[Index] = In.R(Index);
+	}
+	m_ModulationLineLeft.Write(Dry.Left, In.Size);
+	m_ModulationLineRight.Write(Dry.Right, In.Size);
+	m_ModulationLineLeft.Read(Dry.Left, Delays.Left, In.Size);
+	m_ModulationLineRight.Read(Dry.Right, Delays.Right, In.Size);
+
+	for(size_t Index = 0; Index < In.Size; Index++){
 #ifdef PENDAI
-	pOut->Left = m_ModulationLineLeft.Pull(DelayLeft) * VolumeModulationLeft;
-	pOut->Right = m_ModulationLineRight.Pull(DelayLeft) * VolumeModulationLeft;
+		Out.L(Index) = Dry.Left[Index] * Volume.Left[Index];
+		Out.R(Index) = Dry.Right[Index] * pVolumeRight[Index];
 #elif defined(PENDAII)
-	pOut->Left = m_ModulationLineLeft.Pull(DelayLeft) * VolumeModulationLeft * m_GainWet * 1.2f;
-	pOut->Right = m_ModulationLineRight.Pull(DelayRight) * VolumeModulationRight * m_GainWet * 1.2f;
+		Out.L(Index) = Dry.Left[Index] * Volume.Left[Index] * Gain;
+		Out.R(Index) = Dry.Right[Index] * pVolumeRight[Index] * Gain;
 #endif
+	}
 }
 
 // --------------------------------------------------------------------------
 // Callback to update the LFO frequency based on user interaction
-void cTremolo::SpeedChange(DadUI::cParameter *pParameter, uint32_t CallbackUserData){
+void cTremolo::SpeedChange(DadUI::cParameter *pParameter, uintptr_t CallbackUserData){
 	cTremolo *pthis = reinterpret_cast<cTremolo *>(CallbackUserData);
-	pthis->m_LFOLeft.setFreq(pParameter->getValue());
-	pthis->m_LFORight.setFreq(pParameter->getValue());
+	pthis->m_LFO.setFreq(pParameter->getValue());
 
 	// Compute compensation factor to keep vibrato depth consistent across LFO frequencies.
 	// This avoids a shallower vibrato effect when the LFO speed increases.
@@ -195,15 +328,21 @@ void cTremolo::SpeedChange(DadUI::cParameter *pParameter, uint32_t CallbackUserD
 
 // --------------------------------------------------------------------------
 // Callback to update the LFO duty cycle ratio
-void cTremolo::RatioChange(DadUI::cParameter *pParameter, uint32_t CallbackUserData){
+void cTremolo::RatioChange(DadUI::cParameter *pParameter, uintptr_t CallbackUserData){
 	cTremolo *pthis = reinterpret_cast<cTremolo *>(CallbackUserData);
-	pthis->m_LFOLeft.setNormalizedDutyCycle(pParameter->getNormalizedValue());
-	pthis->m_LFORight.setNormalizedDutyCycle(pParameter->getNormalizedValue());
+	pthis->m_LFO.setNormalizedDutyCycle(pParameter->getNormalizedValue());
 }
 // --------------------------------------------------------------------------
-// Callback to update the Tremolo Deep parameter
-void cTremolo::MixChange(DadUI::cParameter *pParameter, uint32_t CallbackUserData){
+// Callback to update the dry/wet mix
+void cTremolo::MixChange(DadUI::cParameter *pParameter, uintptr_t CallbackUserData){
 	cTremolo *pthis = reinterpret_cast<cTremolo *>(CallbackUserData);
 	pthis->m_GainWet = DadUI::cPendaUI::m_Volumes.MixDryWet(*pParameter);
 }
+
+// --------------------------------------------------------------------------
+// Callback to update the depth constants of the volume modulation
+void cTremolo::DeepChange(DadUI::cParameter *pParameter, uintptr_t CallbackUserData){
+	cTremolo *pthis = reinterpret_cast<cTremolo *>(CallbackUserData);
+	pthis->m_Gain.setDepth(pParameter->getValue());
+}
 } // namespace DadEffect
@@ -0,0 +1,26 @@
+//====================================================================================
+// TremoloDelay.cpp
+//
+// Tremolo -> Delay effect chain
+//
+// Copyright(c) 2025 Dad Design.
+//====================================================================================
+
+#include "TremoloDelay.h"
+
+namespace DadEffect {
+
+//***********************************************************************************
+//  cTremoloDelay
+//***********************************************************************************
+
+// --------------------------------------------------------------------------
+// Initializes the effects and the chain user interface
+void cTremoloDelay::Initialize(){
+	InitChain(TremoloDelaySerializeID);
+	addSlot(&m_Tremolo, "Trem.", "Tremolo");
+	addSlot(&m_Delay, "Delay", "Delay", true);
+	StartChain();
+}
+
+} // namespace DadEffect
@@ -0,0 +1,43 @@
+#pragma once
+//====================================================================================
+// HostPlatform.h
+//
+// Host build (PENDA_HOST) of the DSP, effect and user interface layers.
+// Provides what Core/ provides on target: the globals of main.cpp (display,
+// persistent storage, UI object manager, effect arena, audio block size), the
+// HAL stub functions and a simulated time base.
+//
+// Copyright(c) 2025 Dad Design.
+//====================================================================================
+#include "main.h"
+#include <mutex>
+
+// Effect arena size (SDRAM block of main.cpp on target)
+constexpr size_t EFFECT_ARENA_SIZE = 16 * 1024 * 1024;
+
+namespace DadHost {
+
+// --------------------------------------------------------------------------
+// Initializes the platform: audio block size, display (off screen), persistent
+// storage (in RAM), effect arena and user interface.
+// Must be called once, before any effect is initialized.
+void Init(uint32_t AudioBufferSize = AUDIO_BUFFER_SIZE_DEFAULT);
+
+// --------------------------------------------------------------------------
+// Worker threads. The state written while audio is processed (DTCM working
+// buffers, see HostSections.h, GPIO, simulated time) is per thread. The user
+// interface, the volume manager and the effect arena stay shared: effect
+// creation, destruction, preset changes and the smoothing of moving
+// parameters are made with the platform mutex held.
+std::mutex &getPlatformMutex();
+
+// --------------------------------------------------------------------------
+// Simulated time: HAL_GetTick() and HAL_Delay() follow it.
+void AdvanceTime(uint32_t Microseconds);
+uint64_t getTime_us();
+
+// --------------------------------------------------------------------------
+// Input pin level (e.g. footswitch pressed: GPIO_PIN_RESET)
+void setInputPin(GPIO_TypeDef *pPort, uint16_t Pin, GPIO_PinState State);
+
+} // namespace DadHost
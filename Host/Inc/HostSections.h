@@ -0,0 +1,18 @@
+#pragma once
+//====================================================================================
+// HostSections.h
+//
+// Host build (PENDA_HOST): memory section qualifiers of main.h.
+// The memories of the target do not exist on the host: the data is placed in
+// plain storage, except the DTCM working state of the audio path, which is per
+// thread so that several effects can render in parallel (see
+// Host/Tools/PendaBatch.cpp).
+//
+// Copyright(c) 2025 Dad Design.
+//====================================================================================
+
+#define SDRAM_SECTION
+#define QFLASH_SECTION
+#define NO_CACHE_RAM
+#define ITCM
+#define DTCM_SECTION thread_local
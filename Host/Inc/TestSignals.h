@@ -0,0 +1,30 @@
+#pragma once
+//====================================================================================
+// TestSignals.h
+//
+// Host build: deterministic test signals (same samples on every host).
+//
+// Copyright(c) 2025 Dad Design.
+//====================================================================================
+#include "cWavFile.h"
+
+namespace DadHost {
+
+// --------------------------------------------------------------------------
+// Unit impulse at t = 10 ms, then silence
+void MakeImpulse(cWavFile &Signal, float Duration);
+
+// --------------------------------------------------------------------------
+// Exponential sine sweep from F0 to F1 (Hz), amplitude Level
+void MakeSweep(cWavFile &Signal, float Duration, float F0, float F1, float Level = 0.5f);
+
+// --------------------------------------------------------------------------
+// White noise (fixed seed linear congruential generator), amplitude Level
+void MakeNoise(cWavFile &Signal, float Duration, float Level = 0.25f);
+
+// --------------------------------------------------------------------------
+// Decaying plucks of Frequency Hz every Period seconds (guitar-like envelope),
+// right channel a fifth above the left one
+void MakePlucks(cWavFile &Signal, float Duration, float Frequency, float Period, float Level = 0.5f);
+
+} // namespace DadHost
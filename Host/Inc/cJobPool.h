@@ -0,0 +1,62 @@
+#pragma once
+//====================================================================================
+// cJobPool.h
+//
+// Host build: work stealing thread pool for batches of independent jobs.
+//
+// Each worker owns a deque of job indexes, dealt round robin at start. A worker
+// takes its jobs from the back of its own deque and, once it is empty, steals
+// from the front of the others: long jobs left on a slow worker are picked up
+// by the idle ones. Jobs do not create jobs, so a worker stops as soon as every
+// deque is empty.
+//
+// Copyright(c) 2025 Dad Design.
+//====================================================================================
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace DadHost {
+
+//***********************************************************************************
+// class cJobPool
+//***********************************************************************************
+class cJobPool {
+public:
+	// --------------------------------------------------------------------------
+	// Job(JobIndex, WorkerIndex)
+	using tJob = std::function<void(size_t, unsigned)>;
+
+	// --------------------------------------------------------------------------
+	// Runs Job for every index in [0, nJobs) on nWorkers threads and returns
+	// when all are done.
+	void Run(size_t nJobs, unsigned nWorkers, const tJob &Job);
+
+	// --------------------------------------------------------------------------
+	// Statistics of the last Run()
+	inline size_t getSteals() const { return m_Steals; }
+	inline const std::vector<size_t> &getJobsPerWorker() const { return m_JobsPerWorker; }
+
+protected:
+	// --------------------------------------------------------------------------
+	// Next job of a worker (own deque first, then steal). False when all are done.
+	bool NextJob(unsigned Worker, size_t &JobIndex, bool &Stolen);
+
+	// --------------------------------------------------------------------------
+	// Worker deque
+	struct sQueue {
+		std::mutex			Mutex;
+		std::deque<size_t>	Jobs;
+	};
+
+	// --------------------------------------------------------------------------
+	// Member variables
+	std::vector<std::unique_ptr<sQueue>> m_Queues;
+	size_t				m_Steals = 0;
+	std::vector<size_t>	m_JobsPerWorker;
+};
+
+} // namespace DadHost
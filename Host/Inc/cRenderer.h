@@ -0,0 +1,134 @@
+#pragma once
+//====================================================================================
+// cRenderer.h
+//
+// Host build: offline rendering of an effect over a WAV file.
+//
+// The effect runs as on the pedal: blocks of __AudioBufferSize frames, planar
+// buffers, cPendaUI::RTProcess() called once per block before the effect (so
+// parameter smoothing runs at UI_RT_SAMPLING_RATE) and the simulated time
+// advancing by one block duration.
+//
+// Each renderer owns its effect, its GUI objects and its effect arena: several
+// renderers can run in parallel, one per thread (see DadHost::getPlatformMutex).
+//
+// Presets are the cSerialize blobs saved by cUIMemory (cPendaUI::Save of the
+// effect SerializeID), either raw (.bin) or as a text file holding one value
+// per line in serialization order ('#' starts a comment).
+//
+// Copyright(c) 2025 Dad Design.
+//====================================================================================
+#include "HostPlatform.h"
+#include "AudioBlock.h"
+#include "cWavFile.h"
+#include "cArena.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace DadUI { class iGUIObject; class cParameter; }
+
+namespace DadHost {
+
+//***********************************************************************************
+// Effects available on the host
+//***********************************************************************************
+class iHostEffect {
+public:
+	virtual ~iHostEffect() {}
+	virtual void Process(const AudioBlock &In, const AudioBlock &Out) = 0;
+};
+
+template<typename T>
+class cHostEffect : public iHostEffect {
+public:
+	cHostEffect() { m_Effect.Initialize(); }
+	void Process(const AudioBlock &In, const AudioBlock &Out) override { m_Effect.Process(In, Out); }
+protected:
+	T	m_Effect;
+};
+
+struct sHostEffect {
+	const char		*Name;					// Command line name
+	uint32_t		SerializeID;			// ID of the effect presets
+	iHostEffect*	(*Create)();			// Creates and initializes the effect
+};
+
+// --------------------------------------------------------------------------
+// Preset value change at a given time (applied at the next block boundary)
+struct sAutomation {
+	float			Time;					// Seconds from the start of the render
+	uint32_t		Index;					// Preset value index (serialization order)
+	float			Value;
+};
+
+// --------------------------------------------------------------------------
+// Effect table
+const sHostEffect *FindEffect(const std::string &Name);
+const sHostEffect *getEffects(size_t &Count);
+
+//***********************************************************************************
+// class cRenderer
+//***********************************************************************************
+class cRenderer {
+public:
+	// --------------------------------------------------------------------------
+	// Creates the effect (DadHost::Init must have been called). The effect
+	// allocates its buffers
+	// in the arena of the renderer, released when the renderer is destroyed.
+	void Init(const sHostEffect &Effect);
+	~cRenderer();
+
+	// --------------------------------------------------------------------------
+	// Presets
+	void RestorePreset(const std::vector<uint8_t> &Blob);
+	std::vector<uint8_t> SavePreset();
+
+	// --------------------------------------------------------------------------
+	// Runs silent blocks until every parameter has reached its target value
+	// (at most MaxTime seconds). Returns the settling time in seconds.
+	float Settle(float MaxTime);
+
+	// --------------------------------------------------------------------------
+	// Renders In into Out (same length and sample rate).
+	// Returns the wall clock processing time in seconds.
+	double Render(const cWavFile &In, cWavFile &Out);
+
+	// --------------------------------------------------------------------------
+	// Same, with preset changes during the render (sorted by time)
+	double Render(const cWavFile &In, cWavFile &Out, const std::vector<sAutomation> &Automation);
+
+protected:
+	// --------------------------------------------------------------------------
+	// Processes one block (nFrames <= AUDIO_BUFFER_SIZE, zero padded)
+	void ProcessBlock(const float *pInL, const float *pInR, float *pOutL, float *pOutR, size_t nFrames);
+
+	// --------------------------------------------------------------------------
+	// True while a parameter of the effect has not reached its target value
+	bool isMoving() const;
+
+	// --------------------------------------------------------------------------
+	// Member variables
+	const sHostEffect	*m_pDesc = nullptr;
+	iHostEffect			*m_pEffect = nullptr;
+	std::vector<DadUI::iGUIObject *> m_Objects;	// GUI objects created by the effect
+	std::vector<DadUI::cParameter *> m_Parameters;	// Parameters among them
+	std::unique_ptr<uint8_t[]> m_pArenaMemory;		// Effect arena (uninitialized, as SDRAM)
+	double				m_TimeError_us = 0.0;		// Simulated time fraction not yet applied
+	AudioPlanarBuffer<AUDIO_BUFFER_SIZE_MAX> m_In;
+	AudioPlanarBuffer<AUDIO_BUFFER_SIZE_MAX> m_Out;
+};
+
+//***********************************************************************************
+// Preset files
+//***********************************************************************************
+bool LoadBlob(const std::string &Path, std::vector<uint8_t> &Blob);
+bool SaveBlob(const std::string &Path, const std::vector<uint8_t> &Blob);
+bool LoadTextPreset(const std::string &Path, std::vector<uint8_t> &Blob);
+bool SaveTextPreset(const std::string &Path, const std::vector<uint8_t> &Blob, const char *EffectName);
+
+// --------------------------------------------------------------------------
+// Replaces the value Index of a blob (false if Index is out of range)
+bool setPresetValue(std::vector<uint8_t> &Blob, size_t Index, float Value);
+
+} // namespace DadHost
@@ -0,0 +1,59 @@
+#pragma once
+//====================================================================================
+// cWavFile.h
+//
+// Host build: stereo WAV file read / write.
+// Reads PCM 16, 24, 32 bits and IEEE float 32 bits, mono or stereo (mono is
+// duplicated on both channels). Writes PCM 16, 24 bits or float 32 bits, stereo.
+//
+// Copyright(c) 2025 Dad Design.
+//====================================================================================
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace DadHost {
+
+//***********************************************************************************
+// class cWavFile
+//***********************************************************************************
+class cWavFile {
+public:
+	// --------------------------------------------------------------------------
+	// Sample formats supported by Save()
+	enum class eFormat {
+		PCM16,
+		PCM24,
+		Float32
+	};
+
+	// --------------------------------------------------------------------------
+	// Loads a WAV file (returns false and sets the error message on failure)
+	bool Load(const std::string &Path);
+
+	// --------------------------------------------------------------------------
+	// Saves the samples as a stereo WAV file
+	bool Save(const std::string &Path, eFormat Format = eFormat::PCM24) const;
+
+	// --------------------------------------------------------------------------
+	// Allocates nFrames frames of silence
+	void Create(size_t nFrames, uint32_t SampleRate);
+
+	// --------------------------------------------------------------------------
+	// Accessors
+	inline size_t getSize() const { return m_Left.size(); }
+	inline uint32_t getSampleRate() const { return m_SampleRate; }
+	inline float getDuration() const { return static_cast<float>(m_Left.size()) / m_SampleRate; }
+	inline const std::string &getError() const { return m_Error; }
+
+	// --------------------------------------------------------------------------
+	// Member variables
+	std::vector<float>	m_Left;				// Left samples [-1.0, 1.0]
+	std::vector<float>	m_Right;			// Right samples [-1.0, 1.0]
+
+protected:
+	uint32_t			m_SampleRate = 48000;
+	std::string			m_Error;
+};
+
+} // namespace DadHost
@@ -0,0 +1,191 @@
+//****************************************************************************
+// Host platform: STM32H7 HAL stub
+//
+// Replaces the STM32 HAL when the DSP, effect and UI layers are built on a
+// workstation (PENDA_HOST). Only the types, registers and functions used
+// outside Core/ are provided:
+//   - peripherals handles are empty structures,
+//   - GPIO inputs read their IDR (all pins high by default: pull-ups, switches
+//     released), outputs write their ODR,
+//   - SPI DMA transfers complete at once (the completion callback is called
+//     from HAL_SPI_Transmit_DMA),
+//   - HAL_GetTick() follows a simulated time (see HostPlatform.h),
+//   - DWT->CYCCNT reads the host clock scaled to SystemCoreClock,
+//   - interrupts do not exist: __disable_irq()/__enable_irq() do nothing.
+//
+// File: stm32h7xx_hal.h
+// Copyright (c) 2025 Dad Design.
+//****************************************************************************
+#ifndef __STM32H7xx_HAL_H
+#define __STM32H7xx_HAL_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <math.h>					// Included by stm32h7xx_hal_def.h on target
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ---------------------------------------------------------------------------
+// Status
+typedef enum {
+	HAL_OK       = 0x00U,
+	HAL_ERROR    = 0x01U,
+	HAL_BUSY     = 0x02U,
+	HAL_TIMEOUT  = 0x03U
+} HAL_StatusTypeDef;
+
+#define __IO volatile
+
+// ---------------------------------------------------------------------------
+// Cortex-M core
+static inline void __disable_irq(void) {}
+static inline void __enable_irq(void) {}
+static inline void __DSB(void) {}
+static inline void __ISB(void) {}
+static inline void __DMB(void) {}
+static inline void __NOP(void) {}
+
+static inline void SCB_EnableICache(void) {}
+static inline void SCB_EnableDCache(void) {}
+static inline void SCB_CleanDCache_by_Addr(void *addr, int32_t dsize) { (void)addr; (void)dsize; }
+static inline void SCB_InvalidateDCache_by_Addr(void *addr, int32_t dsize) { (void)addr; (void)dsize; }
+static inline void SCB_CleanInvalidateDCache_by_Addr(void *addr, int32_t dsize) { (void)addr; (void)dsize; }
+
+extern uint32_t SystemCoreClock;			// 480 MHz, as on target
+void SystemCoreClockUpdate(void);
+
+// Cycle counter
+uint32_t HostCycleCounter(void);
+
+#ifdef __cplusplus
+// DWT->CYCCNT : reads the host clock in SystemCoreClock cycles
+struct sHostCYCCNT {
+	inline operator uint32_t() const { return HostCycleCounter() - m_Origin; }
+	inline sHostCYCCNT &operator=(uint32_t Value) { m_Origin = HostCycleCounter() - Value; return *this; }
+	uint32_t m_Origin = 0;
+};
+typedef struct {
+	uint32_t	CTRL;
+	sHostCYCCNT	CYCCNT;
+} DWT_Type;
+#endif
+
+typedef struct {
+	uint32_t	DEMCR;
+} CoreDebug_Type;
+
+#define DWT_CTRL_CYCCNTENA_Msk			(1UL)
+#define CoreDebug_DEMCR_TRCENA_Msk		(1UL << 24U)
+
+#ifdef __cplusplus
+extern DWT_Type			__HostDWT;
+#define DWT				(&__HostDWT)
+#endif
+extern CoreDebug_Type	__HostCoreDebug;
+#define CoreDebug		(&__HostCoreDebug)
+
+// ---------------------------------------------------------------------------
+// Tick (simulated time, ms)
+uint32_t HAL_GetTick(void);
+void HAL_Delay(uint32_t Delay);
+
+// ---------------------------------------------------------------------------
+// GPIO
+typedef struct {
+	uint32_t	IDR;			// Input levels
+	uint32_t	ODR;			// Output levels
+} GPIO_TypeDef;
+
+typedef enum {
+	GPIO_PIN_RESET = 0U,
+	GPIO_PIN_SET
+} GPIO_PinState;
+
+typedef struct {
+	uint32_t Pin;
+	uint32_t Mode;
+	uint32_t Pull;
+	uint32_t Speed;
+	uint32_t Alternate;
+} GPIO_InitTypeDef;
+
+#define GPIO_PIN_0		((uint16_t)0x0001)
+#define GPIO_PIN_1		((uint16_t)0x0002)
+#define GPIO_PIN_2		((uint16_t)0x0004)
+#define GPIO_PIN_3		((uint16_t)0x0008)
+#define GPIO_PIN_4		((uint16_t)0x0010)
+#define GPIO_PIN_5		((uint16_t)0x0020)
+#define GPIO_PIN_6		((uint16_t)0x0040)
+#define GPIO_PIN_7		((uint16_t)0x0080)
+#define GPIO_PIN_8		((uint16_t)0x0100)
+#define GPIO_PIN_9		((uint16_t)0x0200)
+#define GPIO_PIN_10		((uint16_t)0x0400)
+#define GPIO_PIN_11		((uint16_t)0x0800)
+#define GPIO_PIN_12		((uint16_t)0x1000)
+#define GPIO_PIN_13		((uint16_t)0x2000)
+#define GPIO_PIN_14		((uint16_t)0x4000)
+#define GPIO_PIN_15		((uint16_t)0x8000)
+
+extern thread_local GPIO_TypeDef __HostGPIO[11];		// Per thread (see HostPlatform.h)
+#define GPIOA	(&__HostGPIO[0])
+#define GPIOB	(&__HostGPIO[1])
+#define GPIOC	(&__HostGPIO[2])
+#define GPIOD	(&__HostGPIO[3])
+#define GPIOE	(&__HostGPIO[4])
+#define GPIOF	(&__HostGPIO[5])
+#define GPIOG	(&__HostGPIO[6])
+#define GPIOH	(&__HostGPIO[7])
+#define GPIOI	(&__HostGPIO[8])
+#define GPIOJ	(&__HostGPIO[9])
+#define GPIOK	(&__HostGPIO[10])
+
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin);
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState);
+void HAL_GPIO_TogglePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin);
+void HAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_InitTypeDef *GPIO_Init);
+
+// ---------------------------------------------------------------------------
+// Peripheral handles
+typedef struct { uint32_t Instance; } UART_HandleTypeDef;
+typedef struct { uint32_t Instance; } TIM_HandleTypeDef;
+typedef struct { uint32_t Instance; } QSPI_HandleTypeDef;
+typedef struct { uint32_t Instance; } SAI_HandleTypeDef;
+typedef struct { uint32_t Instance; } I2C_HandleTypeDef;
+typedef struct { uint32_t Instance; } DMA_HandleTypeDef;
+typedef struct { uint32_t Instance; } DMA2D_HandleTypeDef;
+
+typedef struct __SPI_HandleTypeDef {
+	uint32_t Instance;
+	void (*TxCpltCallback)(struct __SPI_HandleTypeDef *hspi);
+} SPI_HandleTypeDef;
+
+// ---------------------------------------------------------------------------
+// UART
+HAL_StatusTypeDef HAL_UART_Receive_DMA(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
+void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart);
+void HAL_UART_RxHalfCpltCallback(UART_HandleTypeDef *huart);
+
+// ---------------------------------------------------------------------------
+// Timers
+HAL_StatusTypeDef HAL_TIM_Base_Start_IT(TIM_HandleTypeDef *htim);
+HAL_StatusTypeDef HAL_TIM_Base_Stop_IT(TIM_HandleTypeDef *htim);
+void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim);
+
+// ---------------------------------------------------------------------------
+// SPI
+typedef enum {
+	HAL_SPI_TX_COMPLETE_CB_ID = 0x00U
+} HAL_SPI_CallbackIDTypeDef;
+typedef void (*pSPI_CallbackTypeDef)(SPI_HandleTypeDef *hspi);
+
+HAL_StatusTypeDef HAL_SPI_RegisterCallback(SPI_HandleTypeDef *hspi, HAL_SPI_CallbackIDTypeDef CallbackID, pSPI_CallbackTypeDef pCallback);
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef *hspi, const uint8_t *pData, uint16_t Size, uint32_t Timeout);
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef *hspi, const uint8_t *pData, uint16_t Size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __STM32H7xx_HAL_H */
@@ -0,0 +1,181 @@
+//====================================================================================
+// HostPlatform.cpp
+//
+// Host build: platform globals, HAL stub and simulated time
+//
+// Copyright(c) 2025 Dad Design.
+//====================================================================================
+#include "HostPlatform.h"
+#include "PendaUI.h"
+#include "cDisplay.h"
+#include "cMemory.h"
+#include "cArena.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+//***********************************************************************************
+// Globals defined by Core/ on target
+//***********************************************************************************
+
+// Audio block size (Audio.cpp)
+uint32_t __AudioBufferSize = AUDIO_BUFFER_SIZE_DEFAULT;
+
+// GFX (main.cpp)
+DECLARE_DISPLAY(__Display);
+
+// Persistent storage (main.cpp), kept in RAM (HostStorage.cpp)
+DadQSPI::cQSPI_PersistentStorage __PersistentStorage;
+
+// UI Object Manager (main.cpp)
+DadUI::cUIObjectManager __UIObjManager;
+
+// Effect buffers arena (main.cpp)
+alignas(16) static uint8_t __EffectArenaMemory[EFFECT_ARENA_SIZE];
+DadMisc::cArena __EffectArena;
+
+// ------------------------------------------------------------------------
+// Error_Handler : no recovery on host
+void Error_Handler(void) {
+	fprintf(stderr, "PENDA host: Error_Handler()\n");
+	abort();
+}
+
+//***********************************************************************************
+// HAL stub state
+//***********************************************************************************
+uint32_t		SystemCoreClock = 480000000;
+DWT_Type		__HostDWT;
+CoreDebug_Type	__HostCoreDebug;
+thread_local GPIO_TypeDef __HostGPIO[11] = {
+	{0xFFFF, 0}, {0xFFFF, 0}, {0xFFFF, 0}, {0xFFFF, 0}, {0xFFFF, 0}, {0xFFFF, 0},
+	{0xFFFF, 0}, {0xFFFF, 0}, {0xFFFF, 0}, {0xFFFF, 0}, {0xFFFF, 0}
+};
+
+static thread_local uint64_t __HostTime_us = 0;	// Simulated time
+static std::mutex			__HostPlatformMutex;	// Shared UI and arena
+static SPI_HandleTypeDef	__HostSPI = {};
+static UART_HandleTypeDef	__HostUART = {};
+static TIM_HandleTypeDef	__HostTIM6 = {};
+
+namespace DadHost {
+
+// --------------------------------------------------------------------------
+// Initializes the platform
+void Init(uint32_t AudioBufferSize) {
+	__AudioBufferSize = AudioBufferSize;
+
+	INIT_DISPLAY(__Display, &__HostSPI);
+
+	if(__PersistentStorage.Init()){
+		__PersistentStorage.InitializeMemory();
+	}
+
+	__EffectArena.Init(__EffectArenaMemory, EFFECT_ARENA_SIZE);
+
+	DadUI::cPendaUI::Init("PENDA", "Host", &__HostUART, &__HostTIM6);
+}
+
+std::mutex &getPlatformMutex() {
+	return __HostPlatformMutex;
+}
+
+// --------------------------------------------------------------------------
+// Simulated time
+void AdvanceTime(uint32_t Microseconds) {
+	__HostTime_us += Microseconds;
+}
+
+uint64_t getTime_us() {
+	return __HostTime_us;
+}
+
+// --------------------------------------------------------------------------
+// Input pin level
+void setInputPin(GPIO_TypeDef *pPort, uint16_t Pin, GPIO_PinState State) {
+	if(State == GPIO_PIN_SET){
+		pPort->IDR |= Pin;
+	}else{
+		pPort->IDR &= ~static_cast<uint32_t>(Pin);
+	}
+}
+
+} // namespace DadHost
+
+//***********************************************************************************
+// HAL stub functions
+//***********************************************************************************
+
+// ------------------------------------------------------------------------
+// Core
+void SystemCoreClockUpdate(void) {}
+
+uint32_t HostCycleCounter(void) {
+	uint64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+	                  std::chrono::steady_clock::now().time_since_epoch()).count();
+	return static_cast<uint32_t>((ns * (SystemCoreClock / 1000000)) / 1000);
+}
+
+// ------------------------------------------------------------------------
+// Tick
+uint32_t HAL_GetTick(void) {
+	return static_cast<uint32_t>(__HostTime_us / 1000);
+}
+
+void HAL_Delay(uint32_t Delay) {
+	__HostTime_us += static_cast<uint64_t>(Delay) * 1000;
+}
+
+// ------------------------------------------------------------------------
+// GPIO
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin) {
+	return (GPIOx->IDR & GPIO_Pin) ? GPIO_PIN_SET : GPIO_PIN_RESET;
+}
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState) {
+	if(PinState == GPIO_PIN_SET){
+		GPIOx->ODR |= GPIO_Pin;
+	}else{
+		GPIOx->ODR &= ~static_cast<uint32_t>(GPIO_Pin);
+	}
+}
+
+void HAL_GPIO_TogglePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin) {
+	GPIOx->ODR ^= GPIO_Pin;
+}
+
+void HAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_InitTypeDef *GPIO_Init) {}
+
+// ------------------------------------------------------------------------
+// UART (no MIDI input)
+HAL_StatusTypeDef HAL_UART_Receive_DMA(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size) {
+	return HAL_OK;
+}
+
+// ------------------------------------------------------------------------
+// Timers (no interrupt)
+HAL_StatusTypeDef HAL_TIM_Base_Start_IT(TIM_HandleTypeDef *htim) {
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_Base_Stop_IT(TIM_HandleTypeDef *htim) {
+	return HAL_OK;
+}
+
+// ------------------------------------------------------------------------
+// SPI (transfers complete at once)
+HAL_StatusTypeDef HAL_SPI_RegisterCallback(SPI_HandleTypeDef *hspi, HAL_SPI_CallbackIDTypeDef CallbackID, pSPI_CallbackTypeDef pCallback) {
+	hspi->TxCpltCallback = pCallback;
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef *hspi, const uint8_t *pData, uint16_t Size, uint32_t Timeout) {
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef *hspi, const uint8_t *pData, uint16_t Size) {
+	if(hspi->TxCpltCallback != nullptr){
+		hspi->TxCpltCallback(hspi);
+	}
+	return HAL_OK;
+}
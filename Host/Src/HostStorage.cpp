@@ -0,0 +1,86 @@
+//====================================================================================
+// HostStorage.cpp
+//
+// Host build: persistent storage kept in RAM
+// (replaces QSPI.cpp, same cQSPI_PersistentStorage interface)
+//
+// Copyright(c) 2025 Dad Design.
+//====================================================================================
+#include "QSPI.h"
+#include <cstring>
+#include <map>
+#include <vector>
+
+// Saves by save number
+static std::map<uint32_t, std::vector<uint8_t>> __HostSaves;
+
+namespace DadQSPI{
+
+//***********************************************************************************
+// class cQSPI_PersistentStorage
+//***********************************************************************************
+
+// --------------------------------------------------------------------------
+// Initializes the persistent storage system
+bool cQSPI_PersistentStorage::Init(){
+	sMainBloc   MainBloc;
+	uint32_t	ReadSize;
+
+	Load(kIDMain, &MainBloc, sizeof(MainBloc), ReadSize);
+	if((ReadSize != sizeof(MainBloc)) || (MainBloc.MaGicBuild != kMaGicBuild) || (MainBloc.NumBuild != kNumBuild)){
+		return true;
+	}
+	return false;
+}
+
+// --------------------------------------------------------------------------
+// Initializes the memory
+void cQSPI_PersistentStorage::InitializeMemory(){
+	sMainBloc   MainBloc;
+
+	InitializeBlock();
+	MainBloc.MaGicBuild = kMaGicBuild;
+	MainBloc.NumBuild = kNumBuild;
+	Save(kIDMain, &MainBloc, sizeof(MainBloc));
+}
+
+// --------------------------------------------------------------------------
+// Erases every save
+void cQSPI_PersistentStorage::InitializeBlock(){
+	__HostSaves.clear();
+}
+
+// --------------------------------------------------------------------------
+// Saves data
+bool cQSPI_PersistentStorage::Save(uint32_t saveNumber, const void* pDataSource, uint32_t Size) {
+	const uint8_t* pData = static_cast<const uint8_t*>(pDataSource);
+	__HostSaves[saveNumber].assign(pData, pData + Size);
+	return true;
+}
+
+// --------------------------------------------------------------------------
+// Loads data (Size = 0 if the save does not exist or does not fit in pData)
+void cQSPI_PersistentStorage::Load(uint32_t saveNumber, void* pData, uint32_t DataSize, uint32_t& Size) {
+	Size = 0;
+	auto it = __HostSaves.find(saveNumber);
+	if((it == __HostSaves.end()) || (it->second.size() > DataSize)){
+		return;
+	}
+	Size = static_cast<uint32_t>(it->second.size());
+	memcpy(pData, it->second.data(), Size);
+}
+
+// --------------------------------------------------------------------------
+// Deletes a save
+void cQSPI_PersistentStorage::Delete(uint32_t saveNumber) {
+	__HostSaves.erase(saveNumber);
+}
+
+// --------------------------------------------------------------------------
+// Size of a save (0 if the save does not exist)
+uint32_t cQSPI_PersistentStorage::getSize(uint32_t saveNumber){
+	auto it = __HostSaves.find(saveNumber);
+	return (it == __HostSaves.end()) ? 0 : static_cast<uint32_t>(it->second.size());
+}
+
+} // namespace DadQSPI
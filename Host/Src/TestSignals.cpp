@@ -0,0 +1,73 @@
+//====================================================================================
+// TestSignals.cpp
+//
+// Host build: deterministic test signals
+//
+// Signals are computed in double precision so that they do not depend on the
+// floating point options of the build.
+//
+// Copyright(c) 2025 Dad Design.
+//====================================================================================
+#include "TestSignals.h"
+#include "main.h"
+#include <algorithm>
+#include <cmath>
+
+namespace DadHost {
+
+constexpr double kTwoPi = 6.283185307179586;
+
+// --------------------------------------------------------------------------
+// Unit impulse at t = 10 ms
+void MakeImpulse(cWavFile &Signal, float Duration) {
+	Signal.Create(static_cast<size_t>(Duration * SAMPLING_RATE), static_cast<uint32_t>(SAMPLING_RATE));
+	const size_t Pos = static_cast<size_t>(0.010f * SAMPLING_RATE);
+	if(Pos < Signal.getSize()){
+		Signal.m_Left[Pos] = 1.0f;
+		Signal.m_Right[Pos] = 1.0f;
+	}
+}
+
+// --------------------------------------------------------------------------
+// Exponential sine sweep
+void MakeSweep(cWavFile &Signal, float Duration, float F0, float F1, float Level) {
+	Signal.Create(static_cast<size_t>(Duration * SAMPLING_RATE), static_cast<uint32_t>(SAMPLING_RATE));
+	const double K = Duration / std::log(static_cast<double>(F1) / F0);
+	for(size_t Index = 0; Index < Signal.getSize(); Index++){
+		double t = Index / static_cast<double>(SAMPLING_RATE);
+		float Value = static_cast<float>(Level * std::sin(kTwoPi * F0 * K * (std::exp(t / K) - 1.0)));
+		Signal.m_Left[Index] = Value;
+		Signal.m_Right[Index] = Value;
+	}
+}
+
+// --------------------------------------------------------------------------
+// White noise
+void MakeNoise(cWavFile &Signal, float Duration, float Level) {
+	Signal.Create(static_cast<size_t>(Duration * SAMPLING_RATE), static_cast<uint32_t>(SAMPLING_RATE));
+	uint32_t Seed = 0x12345678;
+	for(size_t Index = 0; Index < Signal.getSize(); Index++){
+		Seed = Seed * 1664525u + 1013904223u;
+		Signal.m_Left[Index] = Level * (static_cast<int32_t>(Seed) / 2147483648.0f);
+		Seed = Seed * 1664525u + 1013904223u;
+		Signal.m_Right[Index] = Level * (static_cast<int32_t>(Seed) / 2147483648.0f);
+	}
+}
+
+// --------------------------------------------------------------------------
+// Decaying plucks
+void MakePlucks(cWavFile &Signal, float Duration, float Frequency, float Period, float Level) {
+	Signal.Create(static_cast<size_t>(Duration * SAMPLING_RATE), static_cast<uint32_t>(SAMPLING_RATE));
+	const size_t PeriodFrames = static_cast<size_t>(Period * SAMPLING_RATE);
+	for(size_t Index = 0; Index < Signal.getSize(); Index++){
+		double t = (Index % PeriodFrames) / static_cast<double>(SAMPLING_RATE);
+		double Envelope = Level * std::exp(-6.0 * t) * std::min(1.0, t * 1000.0);
+		double Left = std::sin(kTwoPi * Frequency * t) + 0.3 * std::sin(kTwoPi * 2 * Frequency * t)
+		            + 0.1 * std::sin(kTwoPi * 3 * Frequency * t);
+		double Right = std::sin(kTwoPi * 1.5 * Frequency * t) + 0.3 * std::sin(kTwoPi * 3 * Frequency * t);
+		Signal.m_Left[Index] = static_cast<float>(Envelope * Left / 1.4);
+		Signal.m_Right[Index] = static_cast<float>(Envelope * Right / 1.3);
+	}
+}
+
+} // namespace DadHost
@@ -0,0 +1,87 @@
+//====================================================================================
+// cJobPool.cpp
+//
+// Host build: work stealing thread pool
+//
+// Copyright(c) 2025 Dad Design.
+//====================================================================================
+#include "cJobPool.h"
+#include "HostPlatform.h"
+#include <thread>
+
+namespace DadHost {
+
+// --------------------------------------------------------------------------
+// Runs the jobs
+void cJobPool::Run(size_t nJobs, unsigned nWorkers, const tJob &Job) {
+	if(nWorkers == 0){
+		nWorkers = 1;
+	}
+
+	// Jobs dealt round robin
+	m_Queues.clear();
+	for(unsigned Worker = 0; Worker < nWorkers; Worker++){
+		m_Queues.emplace_back(new sQueue);
+	}
+	for(size_t JobIndex = 0; JobIndex < nJobs; JobIndex++){
+		m_Queues[JobIndex % nWorkers]->Jobs.push_back(JobIndex);
+	}
+
+	std::vector<size_t> Steals(nWorkers, 0);
+	m_JobsPerWorker.assign(nWorkers, 0);
+
+	auto Worker = [&](unsigned WorkerIndex) {
+		size_t JobIndex;
+		bool Stolen;
+		while(NextJob(WorkerIndex, JobIndex, Stolen)){
+			Job(JobIndex, WorkerIndex);
+			m_JobsPerWorker[WorkerIndex]++;
+			Steals[WorkerIndex] += Stolen ? 1 : 0;
+		}
+	};
+
+	std::vector<std::thread> Threads;
+	for(unsigned WorkerIndex = 0; WorkerIndex < nWorkers; WorkerIndex++){
+		Threads.emplace_back(Worker, WorkerIndex);
+	}
+	for(std::thread &Thread : Threads){
+		Thread.join();
+	}
+
+	m_Steals = 0;
+	for(size_t Count : Steals){
+		m_Steals += Count;
+	}
+}
+
+// --------------------------------------------------------------------------
+// Next job of a worker
+bool cJobPool::NextJob(unsigned Worker, size_t &JobIndex, bool &Stolen) {
+	// Own deque, newest job first
+	{
+		sQueue &Own = *m_Queues[Worker];
+		std::lock_guard<std::mutex> Lock(Own.Mutex);
+		if(!Own.Jobs.empty()){
+			JobIndex = Own.Jobs.back();
+			Own.Jobs.pop_back();
+			Stolen = false;
+			return true;
+		}
+	}
+
+	// Oldest job of the next non empty deque
+	const size_t nQueues = m_Queues.size();
+	for(size_t Offset = 1; Offset < nQueues; Offset++){
+		sQueue &Victim = *m_Queues[(Worker + Offset) % nQueues];
+		std::lock_guard<std::mutex> Lock(Victim.Mutex);
+		if(!Victim.Jobs.empty()){
+			JobIndex = Victim.Jobs.front();
+			Victim.Jobs.pop_front();
+			Stolen = true;
+			return true;
+		}
+	}
+	return false;
+}
+
+} // namespace DadHost
@@ -0,0 +1,313 @@
+//====================================================================================
+// cRenderer.cpp
+//
+// Host build: offline rendering of an effect over a WAV file
+//
+// Copyright(c) 2025 Dad Design.
+//====================================================================================
+#include "cRenderer.h"
+#include "PendaUI.h"
+#include "Parameter.h"
+#include "Serialize.h"
+#include "Delay.h"
+#include "Tremolo.h"
+#include "EffectTemplate.h"
+#include "TremoloDelay.h"
+#include "ParametricEQ.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+// GUI objects of the effect (HostPlatform.cpp)
+extern DadUI::cUIObjectManager __UIObjManager;
+
+namespace DadHost {
+
+//***********************************************************************************
+// Effects available on the host
+//***********************************************************************************
+template<typename T>
+static iHostEffect *CreateEffect() {
+	return new cHostEffect<T>;
+}
+
+static const sHostEffect __HostEffects[] = {
+	{"delay",			DelaySerializeID,			CreateEffect<DadEffect::cDelay>},
+	{"tremolo",			TremoloSerializeID,			CreateEffect<DadEffect::cTremolo>},
+	{"template",		EffectTemplateSerializeID,	CreateEffect<DadEffect::cEffectTemplate>},
+	{"tremolo-delay",	TremoloDelaySerializeID,	CreateEffect<DadEffect::cTremoloDelay>},
+	{"eq",				ParametricEQSerializeID,	CreateEffect<DadEffect::cParametricEQ>},
+};
+
+// --------------------------------------------------------------------------
+// Effect table
+const sHostEffect *FindEffect(const std::string &Name) {
+	for(const sHostEffect &Effect : __HostEffects){
+		if(Name == Effect.Name){
+			return &Effect;
+		}
+	}
+	return nullptr;
+}
+
+const sHostEffect *getEffects(size_t &Count) {
+	Count = sizeof(__HostEffects) / sizeof(__HostEffects[0]);
+	return __HostEffects;
+}
+
+//***********************************************************************************
+// class cRenderer
+//***********************************************************************************
+
+// --------------------------------------------------------------------------
+// Creates the effect
+void cRenderer::Init(const sHostEffect &Effect) {
+	std::lock_guard<std::mutex> Lock(getPlatformMutex());
+	m_pDesc = &Effect;
+
+	// The effect allocates from __EffectArena: bind it to the memory of this
+	// renderer while the effect is created
+	m_pArenaMemory.reset(new uint8_t[EFFECT_ARENA_SIZE]);
+	DadMisc::cArena PlatformArena = __EffectArena;
+	__EffectArena.Init(m_pArenaMemory.get(), EFFECT_ARENA_SIZE);
+
+	// The GUI objects of the other renderers are hidden while the effect is
+	// created: it sees the user interface as if it were the only effect (e.g.
+	// restoring the system settings only reaches its own parameters)
+	std::vector<DadUI::iGUIObject *> OtherObjects;
+	OtherObjects.swap(__UIObjManager.m_TabGUIObject);
+	m_pEffect = Effect.Create();
+	DadUI::cPendaUI::ReleaseActiveObject();				// No screen: the menu is not kept active
+	m_Objects = __UIObjManager.m_TabGUIObject;
+	for(DadUI::iGUIObject *pObject : m_Objects){
+		DadUI::cParameter *pParameter = dynamic_cast<DadUI::cParameter *>(pObject);
+		if(pParameter != nullptr){
+			m_Parameters.push_back(pParameter);
+		}
+	}
+	__UIObjManager.m_TabGUIObject.swap(OtherObjects);
+	__UIObjManager.m_TabGUIObject.insert(__UIObjManager.m_TabGUIObject.end(), m_Objects.begin(), m_Objects.end());
+
+	__EffectArena = PlatformArena;
+}
+
+cRenderer::~cRenderer() {
+	if(m_pEffect != nullptr){
+		std::lock_guard<std::mutex> Lock(getPlatformMutex());
+
+		// Same isolation for the destruction (the objects unregister themselves)
+		std::vector<DadUI::iGUIObject *> OtherObjects;
+		for(DadUI::iGUIObject *pObject : __UIObjManager.m_TabGUIObject){
+			if(std::find(m_Objects.begin(), m_Objects.end(), pObject) == m_Objects.end()){
+				OtherObjects.push_back(pObject);
+			}
+		}
+		__UIObjManager.m_TabGUIObject = m_Objects;
+		delete m_pEffect;
+		__UIObjManager.m_TabGUIObject.swap(OtherObjects);
+	}
+}
+
+// --------------------------------------------------------------------------
+// Presets (GUI objects of this effect only, as cPendaUI::Save/Restore)
+void cRenderer::RestorePreset(const std::vector<uint8_t> &Blob) {
+	std::lock_guard<std::mutex> Lock(getPlatformMutex());
+	DadQSPI::cSerialize Serializer;
+	Serializer.setBuffer(Blob.data(), Blob.size());
+	for(DadUI::iGUIObject *pObject : m_Objects){
+		pObject->Restore(Serializer, m_pDesc->SerializeID);
+	}
+}
+
+std::vector<uint8_t> cRenderer::SavePreset() {
+	DadQSPI::cSerialize Serializer;
+	for(DadUI::iGUIObject *pObject : m_Objects){
+		pObject->Save(Serializer, m_pDesc->SerializeID);
+	}
+	const uint8_t *pBuffer = nullptr;
+	size_t Size = Serializer.getBuffer(&pBuffer);
+	return std::vector<uint8_t>(pBuffer, pBuffer + Size);
+}
+
+// --------------------------------------------------------------------------
+// Runs silent blocks until every parameter has reached its target value
+float cRenderer::Settle(float MaxTime) {
+	const size_t MaxBlocks = static_cast<size_t>(MaxTime * UI_RT_SAMPLING_RATE);
+	size_t nBlocks = 0;
+	m_In.Clear();
+	for(; nBlocks < MaxBlocks; nBlocks++){
+		if(!isMoving()){
+			break;
+		}
+		ProcessBlock(m_In.Left, m_In.Right, m_Out.Left, m_Out.Right, AUDIO_BUFFER_SIZE);
+	}
+	return nBlocks / UI_RT_SAMPLING_RATE;
+}
+
+// --------------------------------------------------------------------------
+// Renders In into Out
+double cRenderer::Render(const cWavFile &In, cWavFile &Out) {
+	return Render(In, Out, std::vector<sAutomation>());
+}
+
+double cRenderer::Render(const cWavFile &In, cWavFile &Out, const std::vector<sAutomation> &Automation) {
+	const size_t nFrames = In.getSize();
+	Out.Create(nFrames, In.getSampleRate());
+	size_t NextEvent = 0;
+
+	auto Start = std::chrono::steady_clock::now();
+	for(size_t Pos = 0; Pos < nFrames; Pos += AUDIO_BUFFER_SIZE){
+		// Preset changes, as restoring a modified preset would do
+		if((NextEvent < Automation.size()) && (Automation[NextEvent].Time * SAMPLING_RATE <= Pos)){
+			std::vector<uint8_t> Blob = SavePreset();
+			while((NextEvent < Automation.size()) && (Automation[NextEvent].Time * SAMPLING_RATE <= Pos)){
+				setPresetValue(Blob, Automation[NextEvent].Index, Automation[NextEvent].Value);
+				NextEvent++;
+			}
+			RestorePreset(Blob);
+		}
+		ProcessBlock(&In.m_Left[Pos], &In.m_Right[Pos], &Out.m_Left[Pos], &Out.m_Right[Pos],
+		             std::min<size_t>(AUDIO_BUFFER_SIZE, nFrames - Pos));
+	}
+	auto End = std::chrono::steady_clock::now();
+	return std::chrono::duration<double>(End - Start).count();
+}
+
+// --------------------------------------------------------------------------
+// True while a parameter of the effect has not reached its target value
+bool cRenderer::isMoving() const {
+	for(const DadUI::cParameter *pParameter : m_Parameters){
+		if(pParameter->getValue() != pParameter->getTargetValue()){
+			return true;
+		}
+	}
+	return false;
+}
+
+// --------------------------------------------------------------------------
+// Processes one block (same sequence as AudioCallback in main.cpp)
+void cRenderer::ProcessBlock(const float *pInL, const float *pInR, float *pOutL, float *pOutR, size_t nFrames) {
+	if(nFrames < AUDIO_BUFFER_SIZE){
+		m_In.Clear();
+	}
+	if(pInL != m_In.Left){
+		memcpy(m_In.Left, pInL, nFrames * sizeof(float));
+		memcpy(m_In.Right, pInR, nFrames * sizeof(float));
+	}
+
+	m_TimeError_us += AUDIO_BUFFER_SIZE * 1000000.0 / SAMPLING_RATE;
+	uint32_t Elapsed = static_cast<uint32_t>(m_TimeError_us);
+	m_TimeError_us -= Elapsed;
+	AdvanceTime(Elapsed);
+
+	// Parameter smoothing of this effect (the GUI part of cPendaUI::RTProcess).
+	// A moving parameter may call back into the volume manager, shared by the
+	// renderers: the smoothing then runs with the platform mutex held.
+	if(isMoving()){
+		std::lock_guard<std::mutex> Lock(getPlatformMutex());
+		for(DadUI::iGUIObject *pObject : m_Objects){
+			pObject->RTProcess();
+		}
+	}else{
+		for(DadUI::iGUIObject *pObject : m_Objects){
+			pObject->RTProcess();
+		}
+	}
+	m_pEffect->Process(m_In.getBlock(AUDIO_BUFFER_SIZE), m_Out.getBlock(AUDIO_BUFFER_SIZE));
+
+	if(pOutL != m_Out.Left){
+		memcpy(pOutL, m_Out.Left, nFrames * sizeof(float));
+		memcpy(pOutR, m_Out.Right, nFrames * sizeof(float));
+	}
+}
+
+//***********************************************************************************
+// Preset files
+//***********************************************************************************
+
+// --------------------------------------------------------------------------
+// Raw cSerialize blob
+bool LoadBlob(const std::string &Path, std::vector<uint8_t> &Blob) {
+	FILE *pFile = fopen(Path.c_str(), "rb");
+	if(pFile == nullptr){
+		return false;
+	}
+	Blob.clear();
+	uint8_t Chunk[4096];
+	size_t Read;
+	while((Read = fread(Chunk, 1, sizeof(Chunk), pFile)) > 0){
+		Blob.insert(Blob.end(), Chunk, Chunk + Read);
+	}
+	fclose(pFile);
+	return true;
+}
+
+bool SaveBlob(const std::string &Path, const std::vector<uint8_t> &Blob) {
+	FILE *pFile = fopen(Path.c_str(), "wb");
+	if(pFile == nullptr){
+		return false;
+	}
+	bool Ok = fwrite(Blob.data(), 1, Blob.size(), pFile) == Blob.size();
+	fclose(pFile);
+	return Ok;
+}
+
+// --------------------------------------------------------------------------
+// Text preset: one value per line, in serialization order
+bool LoadTextPreset(const std::string &Path, std::vector<uint8_t> &Blob) {
+	FILE *pFile = fopen(Path.c_str(), "r");
+	if(pFile == nullptr){
+		return false;
+	}
+	DadQSPI::cSerialize Serializer;
+	char Line[256];
+	bool Ok = true;
+	while(fgets(Line, sizeof(Line), pFile) != nullptr){
+		char *pComment = strchr(Line, '#');
+		if(pComment != nullptr){
+			*pComment = '\0';
+		}
+		float Value;
+		char Extra;
+		int nRead = sscanf(Line, " %f %c", &Value, &Extra);
+		if(nRead == 1){
+			Serializer.Push(Value);
+		}else if(nRead != EOF){
+			Ok = false;								// Not a single number
+		}
+	}
+	fclose(pFile);
+
+	const uint8_t *pBuffer = nullptr;
+	size_t Size = Serializer.getBuffer(&pBuffer);
+	Blob.assign(pBuffer, pBuffer + Size);
+	return Ok;
+}
+
+bool SaveTextPreset(const std::string &Path, const std::vector<uint8_t> &Blob, const char *EffectName) {
+	FILE *pFile = fopen(Path.c_str(), "w");
+	if(pFile == nullptr){
+		return false;
+	}
+	fprintf(pFile, "# %s preset: one value per line, in serialization order\n", EffectName);
+	for(size_t Index = 0; Index * sizeof(float) < Blob.size(); Index++){
+		float Value;
+		memcpy(&Value, &Blob[Index * sizeof(float)], sizeof(Value));
+		fprintf(pFile, "%.9g\t# %u\n", Value, static_cast<unsigned>(Index));
+	}
+	fclose(pFile);
+	return true;
+}
+
+// --------------------------------------------------------------------------
+// Replaces the value Index of a blob
+bool setPresetValue(std::vector<uint8_t> &Blob, size_t Index, float Value) {
+	if((Index + 1) * sizeof(float) > Blob.size()){
+		return false;
+	}
+	memcpy(&Blob[Index * sizeof(float)], &Value, sizeof(Value));
+	return true;
+}
+
+} // namespace DadHost
@@ -0,0 +1,191 @@
+//====================================================================================
+// cWavFile.cpp
+//
+// Host build: stereo WAV file read / write
+//
+// Copyright(c) 2025 Dad Design.
+//====================================================================================
+#include "cWavFile.h"
+#include <cstdio>
+#include <cstring>
+#include <cmath>
+
+namespace DadHost {
+
+#define WAV_FORMAT_PCM		1
+#define WAV_FORMAT_FLOAT	3
+#define WAV_FORMAT_EXT		0xFFFE
+
+// --------------------------------------------------------------------------
+// Little endian readers / writers
+static inline uint16_t getU16(const uint8_t *p) { return p[0] | (p[1] << 8); }
+static inline uint32_t getU32(const uint8_t *p) { return p[0] | (p[1] << 8) | (p[2] << 16) | (static_cast<uint32_t>(p[3]) << 24); }
+static inline void putU16(std::vector<uint8_t> &Buffer, uint16_t Value) {
+	Buffer.push_back(Value & 0xFF);
+	Buffer.push_back(Value >> 8);
+}
+static inline void putU32(std::vector<uint8_t> &Buffer, uint32_t Value) {
+	for(int Byte = 0; Byte < 4; Byte++){
+		Buffer.push_back((Value >> (8 * Byte)) & 0xFF);
+	}
+}
+
+//***********************************************************************************
+// class cWavFile
+//***********************************************************************************
+
+// --------------------------------------------------------------------------
+// Loads a WAV file
+bool cWavFile::Load(const std::string &Path) {
+	m_Left.clear();
+	m_Right.clear();
+
+	FILE *pFile = fopen(Path.c_str(), "rb");
+	if(pFile == nullptr){
+		m_Error = "cannot open " + Path;
+		return false;
+	}
+	std::vector<uint8_t> Data;
+	uint8_t Chunk[65536];
+	size_t Read;
+	while((Read = fread(Chunk, 1, sizeof(Chunk), pFile)) > 0){
+		Data.insert(Data.end(), Chunk, Chunk + Read);
+	}
+	fclose(pFile);
+
+	if((Data.size() < 12) || (memcmp(&Data[0], "RIFF", 4) != 0) || (memcmp(&Data[8], "WAVE", 4) != 0)){
+		m_Error = Path + " is not a WAV file";
+		return false;
+	}
+
+	// Chunks
+	uint16_t Format = 0, Channels = 0, Bits = 0;
+	const uint8_t *pSamples = nullptr;
+	size_t SamplesSize = 0;
+	size_t Pos = 12;
+	while(Pos + 8 <= Data.size()){
+		const uint8_t *pChunk = &Data[Pos];
+		size_t Size = getU32(pChunk + 4);
+		size_t Available = Data.size() - (Pos + 8);
+		if(Size > Available){
+			Size = Available;								// Truncated file
+		}
+		if((memcmp(pChunk, "fmt ", 4) == 0) && (Size >= 16)){
+			Format = getU16(pChunk + 8);
+			Channels = getU16(pChunk + 10);
+			m_SampleRate = getU32(pChunk + 12);
+			Bits = getU16(pChunk + 22);
+			if((Format == WAV_FORMAT_EXT) && (Size >= 26)){
+				Format = getU16(pChunk + 32);				// Sub format
+			}
+		}else if(memcmp(pChunk, "data", 4) == 0){
+			pSamples = pChunk + 8;
+			SamplesSize = Size;
+		}
+		Pos += 8 + Size + (Size & 1);
+	}
+
+	if((pSamples == nullptr) || (Channels == 0)){
+		m_Error = Path + ": missing fmt or data chunk";
+		return false;
+	}
+	bool IsPCM = (Format == WAV_FORMAT_PCM) && ((Bits == 16) || (Bits == 24) || (Bits == 32));
+	bool IsFloat = (Format == WAV_FORMAT_FLOAT) && (Bits == 32);
+	if(!IsPCM && !IsFloat){
+		m_Error = Path + ": unsupported sample format";
+		return false;
+	}
+
+	// Samples
+	const size_t BytesPerSample = Bits / 8;
+	const size_t nFrames = SamplesSize / (BytesPerSample * Channels);
+	m_Left.resize(nFrames);
+	m_Right.resize(nFrames);
+	for(size_t Frame = 0; Frame < nFrames; Frame++){
+		float Sample[2];
+		for(uint16_t Channel = 0; Channel < 2; Channel++){
+			const uint8_t *p = pSamples + (Frame * Channels + ((Channel < Channels) ? Channel : 0)) * BytesPerSample;
+			if(IsFloat){
+				float Value;
+				memcpy(&Value, p, sizeof(Value));
+				Sample[Channel] = Value;
+			}else if(Bits == 16){
+				Sample[Channel] = static_cast<int16_t>(getU16(p)) / 32768.0f;
+			}else if(Bits == 24){
+				int32_t Value = static_cast<int32_t>((p[0] << 8) | (p[1] << 16) | (static_cast<uint32_t>(p[2]) << 24)) >> 8;
+				Sample[Channel] = Value / 8388608.0f;
+			}else{
+				Sample[Channel] = static_cast<int32_t>(getU32(p)) / 2147483648.0f;
+			}
+		}
+		m_Left[Frame] = Sample[0];
+		m_Right[Frame] = Sample[1];
+	}
+	return true;
+}
+
+// --------------------------------------------------------------------------
+// Saves the samples as a stereo WAV file
+bool cWavFile::Save(const std::string &Path, eFormat Format) const {
+	const uint16_t Bits = (Format == eFormat::PCM16) ? 16 : (Format == eFormat::PCM24) ? 24 : 32;
+	const uint16_t BlockAlign = 2 * Bits / 8;
+	const uint32_t DataSize = static_cast<uint32_t>(m_Left.size() * BlockAlign);
+
+	std::vector<uint8_t> Buffer;
+	Buffer.reserve(44 + DataSize);
+	Buffer.insert(Buffer.end(), {'R', 'I', 'F', 'F'});
+	putU32(Buffer, 36 + DataSize);
+	Buffer.insert(Buffer.end(), {'W', 'A', 'V', 'E', 'f', 'm', 't', ' '});
+	putU32(Buffer, 16);
+	putU16(Buffer, (Format == eFormat::Float32) ? WAV_FORMAT_FLOAT : WAV_FORMAT_PCM);
+	putU16(Buffer, 2);
+	putU32(Buffer, m_SampleRate);
+	putU32(Buffer, m_SampleRate * BlockAlign);
+	putU16(Buffer, BlockAlign);
+	putU16(Buffer, Bits);
+	Buffer.insert(Buffer.end(), {'d', 'a', 't', 'a'});
+	putU32(Buffer, DataSize);
+
+	for(size_t Frame = 0; Frame < m_Left.size(); Frame++){
+		const float Sample[2] = {m_Left[Frame], m_Right[Frame]};
+		for(float Value : Sample){
+			if(Format == eFormat::Float32){
+				uint32_t Raw;
+				memcpy(&Raw, &Value, sizeof(Raw));
+				putU32(Buffer, Raw);
+				continue;
+			}
+			if(Value > 1.0f){
+				Value = 1.0f;
+			}else if(Value < -1.0f){
+				Value = -1.0f;
+			}
+			if(Format == eFormat::PCM16){
+				putU16(Buffer, static_cast<uint16_t>(static_cast<int16_t>(lrintf(Value * 32767.0f))));
+			}else{
+				int32_t Raw = static_cast<int32_t>(lrintf(Value * 8388607.0f));
+				Buffer.push_back(Raw & 0xFF);
+				Buffer.push_back((Raw >> 8) & 0xFF);
+				Buffer.push_back((Raw >> 16) & 0xFF);
+			}
+		}
+	}
+
+	FILE *pFile = fopen(Path.c_str(), "wb");
+	if(pFile == nullptr){
+		return false;
+	}
+	bool Ok = fwrite(Buffer.data(), 1, Buffer.size(), pFile) == Buffer.size();
+	fclose(pFile);
+	return Ok;
+}
+
+// --------------------------------------------------------------------------
+// Allocates nFrames frames of silence
+void cWavFile::Create(size_t nFrames, uint32_t SampleRate) {
+	m_SampleRate = SampleRate;
+	m_Left.assign(nFrames, 0.0f);
+	m_Right.assign(nFrames, 0.0f);
+}
+
+} // namespace DadHost
@@ -0,0 +1,283 @@
+//====================================================================================
+// PendaBatch.cpp
+//
+// Host build: renders every (preset x input) pair of a batch on all the cores.
+//
+//   penda_batch [options] [input.wav ...]
+//
+// Each job creates its own effect (own parameters, delay lines and arena) and
+// renders one input with one preset. Jobs are spread over a work stealing
+// thread pool. Without input, the batch renders the test corpus of penda_regress.
+//
+// Copyright(c) 2025 Dad Design.
+//====================================================================================
+#include "cRenderer.h"
+#include "cJobPool.h"
+#include "TestSignals.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+// --------------------------------------------------------------------------
+// Batch content
+struct sPreset {
+	const DadHost::sHostEffect *pEffect;
+	std::string					Name;			// Output file prefix
+	std::string					Path;			// Empty: default values
+	bool						Text;			// Text or blob preset
+	std::vector<uint8_t>		Blob;			// Complete preset (defaults + file)
+};
+
+struct sInput {
+	std::string					Name;
+	DadHost::cWavFile			Signal;
+};
+
+struct sResult {
+	double						AudioTime;		// Seconds rendered
+	double						JobTime;		// Wall clock seconds of the job
+};
+
+// --------------------------------------------------------------------------
+// Command line help
+static void Usage() {
+	size_t Count;
+	const DadHost::sHostEffect *pEffects = DadHost::getEffects(Count);
+
+	fprintf(stderr,
+		"usage: penda_batch [options] [input.wav ...]\n"
+		"  -e <effect>        effect of the following presets:");
+	for(size_t Index = 0; Index < Count; Index++){
+		fprintf(stderr, " %s", pEffects[Index].Name);
+	}
+	fprintf(stderr, "\n"
+		"                     (an effect without preset renders its default values)\n"
+		"  -p <preset.txt>    text preset (repeatable)\n"
+		"  -b <preset.bin>    cSerialize preset blob (repeatable)\n"
+		"  -j <threads>       worker threads (default: hardware threads, %u)\n"
+		"  -n <frames>        audio block size: 4, 8, 16, 32 or 64 (default %u)\n"
+		"  -o <dir>           writes <dir>/<preset>-<input>.wav (float)\n"
+		"  -c <seconds>       length of the test corpus used without input (default 10)\n"
+		"  --scaling          runs the batch with 1, 2, 4... threads up to -j\n",
+		std::thread::hardware_concurrency(), AUDIO_BUFFER_SIZE_DEFAULT);
+}
+
+// --------------------------------------------------------------------------
+// File name without directory and extension
+static std::string BaseName(const std::string &Path) {
+	size_t Start = Path.find_last_of("/\\");
+	Start = (Start == std::string::npos) ? 0 : Start + 1;
+	size_t End = Path.find_last_of('.');
+	if((End == std::string::npos) || (End < Start)){
+		End = Path.size();
+	}
+	return Path.substr(Start, End - Start);
+}
+
+// --------------------------------------------------------------------------
+// Complete preset blobs: default values of the effect, overlaid with the file
+static bool LoadPresets(std::vector<sPreset> &Presets) {
+	for(sPreset &Preset : Presets){
+		DadHost::cRenderer Renderer;
+		Renderer.Init(*Preset.pEffect);
+		Preset.Blob = Renderer.SavePreset();
+		if(Preset.Path.empty()){
+			continue;
+		}
+		std::vector<uint8_t> File;
+		bool Ok = Preset.Text ? DadHost::LoadTextPreset(Preset.Path, File)
+		                      : DadHost::LoadBlob(Preset.Path, File);
+		if(!Ok){
+			fprintf(stderr, "penda_batch: cannot read preset %s\n", Preset.Path.c_str());
+			return false;
+		}
+		if(File.size() != Preset.Blob.size()){
+			fprintf(stderr, "penda_batch: warning: preset %s holds %zu bytes, %s expects %zu\n",
+					Preset.Path.c_str(), File.size(), Preset.pEffect->Name, Preset.Blob.size());
+		}
+		memcpy(Preset.Blob.data(), File.data(), std::min(Preset.Blob.size(), File.size()));
+	}
+	return true;
+}
+
+// --------------------------------------------------------------------------
+// Runs the batch on nThreads workers, returns the wall clock time
+static double RunBatch(const std::vector<sPreset> &Presets, const std::vector<sInput> &Inputs,
+                       unsigned nThreads, const std::string &OutDir, std::vector<sResult> &Results,
+                       size_t &Steals) {
+	const size_t nJobs = Presets.size() * Inputs.size();
+	Results.assign(nJobs, sResult{0.0, 0.0});
+	std::atomic<bool> WriteError(false);
+
+	DadHost::cJobPool Pool;
+	auto Start = std::chrono::steady_clock::now();
+	Pool.Run(nJobs, nThreads, [&](size_t JobIndex, unsigned Worker) {
+		const sPreset &Preset = Presets[JobIndex / Inputs.size()];
+		const sInput &Input = Inputs[JobIndex % Inputs.size()];
+
+		auto JobStart = std::chrono::steady_clock::now();
+		DadHost::cRenderer Renderer;
+		Renderer.Init(*Preset.pEffect);
+		Renderer.RestorePreset(Preset.Blob);
+		Renderer.Settle(30.0f);
+
+		DadHost::cWavFile Out;
+		Renderer.Render(Input.Signal, Out);
+		if(!OutDir.empty()){
+			std::string Path = OutDir + "/" + Preset.Name + "-" + Input.Name + ".wav";
+			if(!Out.Save(Path, DadHost::cWavFile::eFormat::Float32)){
+				fprintf(stderr, "penda_batch: cannot write %s\n", Path.c_str());
+				WriteError = true;
+			}
+		}
+		auto JobEnd = std::chrono::steady_clock::now();
+
+		Results[JobIndex].AudioTime = Input.Signal.getSize() / static_cast<double>(SAMPLING_RATE);
+		Results[JobIndex].JobTime = std::chrono::duration<double>(JobEnd - JobStart).count();
+	});
+	auto End = std::chrono::steady_clock::now();
+
+	Steals = Pool.getSteals();
+	return WriteError ? -1.0 : std::chrono::duration<double>(End - Start).count();
+}
+
+// --------------------------------------------------------------------------
+// Entry point
+int main(int argc, char *argv[]) {
+	std::vector<sPreset> Presets;
+	std::vector<std::string> InPaths;
+	std::string OutDir;
+	unsigned nThreads = std::max(1u, std::thread::hardware_concurrency());
+	uint32_t BlockSize = AUDIO_BUFFER_SIZE_DEFAULT;
+	float CorpusTime = 10.0f;
+	bool Scaling = false;
+	const DadHost::sHostEffect *pEffect = nullptr;
+	bool EffectHasPreset = false;
+
+	// Arguments ----------------------------------------------------------------
+	for(int Arg = 1; Arg < argc; Arg++){
+		std::string Option = argv[Arg];
+		bool HasValue = (Arg + 1 < argc);
+		if((Option == "-e") && HasValue){
+			if((pEffect != nullptr) && !EffectHasPreset){
+				Presets.push_back({pEffect, pEffect->Name, "", false, {}});
+			}
+			pEffect = DadHost::FindEffect(argv[++Arg]);
+			EffectHasPreset = false;
+			if(pEffect == nullptr){
+				Usage();
+				return 1;
+			}
+		}else if(((Option == "-p") || (Option == "-b")) && HasValue && (pEffect != nullptr)){
+			std::string Path = argv[++Arg];
+			Presets.push_back({pEffect, BaseName(Path), Path, Option == "-p", {}});
+			EffectHasPreset = true;
+		}else if((Option == "-j") && HasValue){
+			nThreads = static_cast<unsigned>(atoi(argv[++Arg]));
+		}else if((Option == "-n") && HasValue){
+			BlockSize = static_cast<uint32_t>(atoi(argv[++Arg]));
+		}else if((Option == "-o") && HasValue){
+			OutDir = argv[++Arg];
+		}else if((Option == "-c") && HasValue){
+			CorpusTime = static_cast<float>(atof(argv[++Arg]));
+		}else if(Option == "--scaling"){
+			Scaling = true;
+		}else if(Option[0] != '-'){
+			InPaths.push_back(Option);
+		}else{
+			Usage();
+			return 1;
+		}
+	}
+	if((pEffect != nullptr) && !EffectHasPreset){
+		Presets.push_back({pEffect, pEffect->Name, "", false, {}});
+	}
+
+	if(Presets.empty() || (nThreads == 0) || (CorpusTime <= 0.0f)){
+		Usage();
+		return 1;
+	}
+	if((BlockSize < AUDIO_BUFFER_SIZE_MIN) || (BlockSize > AUDIO_BUFFER_SIZE_MAX) || (BlockSize & (BlockSize - 1))){
+		fprintf(stderr, "penda_batch: invalid block size %u\n", BlockSize);
+		return 1;
+	}
+
+	// Inputs -------------------------------------------------------------------
+	std::vector<sInput> Inputs(InPaths.empty() ? 4 : InPaths.size());
+	if(InPaths.empty()){
+		Inputs[0].Name = "impulse";
+		DadHost::MakeImpulse(Inputs[0].Signal, CorpusTime);
+		Inputs[1].Name = "sweep";
+		DadHost::MakeSweep(Inputs[1].Signal, CorpusTime, 20.0f, 20000.0f);
+		Inputs[2].Name = "noise";
+		DadHost::MakeNoise(Inputs[2].Signal, CorpusTime);
+		Inputs[3].Name = "plucks";
+		DadHost::MakePlucks(Inputs[3].Signal, CorpusTime, 196.0f, 0.5f);
+	}
+	for(size_t Index = 0; Index < InPaths.size(); Index++){
+		Inputs[Index].Name = BaseName(InPaths[Index]);
+		if(!Inputs[Index].Signal.Load(InPaths[Index])){
+			fprintf(stderr, "penda_batch: %s\n", Inputs[Index].Signal.getError().c_str());
+			return 1;
+		}
+	}
+
+	// Presets ------------------------------------------------------------------
+	DadHost::Init(BlockSize);
+	if(!LoadPresets(Presets)){
+		return 1;
+	}
+
+	// Batch --------------------------------------------------------------------
+	const size_t nJobs = Presets.size() * Inputs.size();
+	printf("%zu preset(s) x %zu input(s) = %zu job(s), block %u\n", Presets.size(), Inputs.size(), nJobs, BlockSize);
+	printf("threads    wall (s)  x realtime   speedup  efficiency  busy  steals\n");
+
+	std::vector<unsigned> ThreadCounts;
+	if(Scaling){
+		for(unsigned Count = 1; Count < nThreads; Count *= 2){
+			ThreadCounts.push_back(Count);
+		}
+	}
+	ThreadCounts.push_back(nThreads);
+
+	std::vector<sResult> Results;
+	double BaseTime = 0.0;
+	for(unsigned Count : ThreadCounts){
+		// Outputs are written by the last run only
+		size_t Steals;
+		bool Last = (Count == ThreadCounts.back());
+		double WallTime = RunBatch(Presets, Inputs, Count, Last ? OutDir : std::string(), Results, Steals);
+		if(WallTime < 0.0){
+			return 1;
+		}
+
+		double AudioTime = 0.0;
+		double JobTime = 0.0;
+		for(const sResult &Result : Results){
+			AudioTime += Result.AudioTime;
+			JobTime += Result.JobTime;
+		}
+		// Speedup and efficiency against the 1 thread run (--scaling), busy: share
+		// of the worker time spent in jobs (idle workers at the end of the batch)
+		if(Count == 1){
+			BaseTime = WallTime;
+		}
+		double Busy = (WallTime > 0.0) ? 100.0 * JobTime / (WallTime * Count) : 0.0;
+		if((BaseTime > 0.0) && (WallTime > 0.0)){
+			double Speedup = BaseTime / WallTime;
+			printf("%7u  %10.3f  %10.1f  %8.2f  %9.0f%%  %4.0f%%  %6zu\n",
+				   Count, WallTime, AudioTime / WallTime, Speedup, 100.0 * Speedup / Count, Busy, Steals);
+		}else{
+			printf("%7u  %10.3f  %10.1f  %8s  %10s  %4.0f%%  %6zu\n",
+				   Count, WallTime, (WallTime > 0.0) ? AudioTime / WallTime : 0.0, "-", "-", Busy, Steals);
+		}
+	}
+	return 0;
+}
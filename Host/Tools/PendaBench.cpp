@@ -0,0 +1,1404 @@
+//====================================================================================
+// PendaBench.cpp
+//
+// Host build: DSP kernel benchmark and equivalence check.
+//
+//   penda_bench [-n <frames>] [-t <floor dBFS>] [-d <seconds>] [-g <GHz>] [case ...]
+//   penda_bench -q
+//   penda_bench -m [-n <frames>]
+//   penda_bench -f
+//   penda_bench -c [-n <frames>]
+//   penda_bench -b [-d <seconds>]
+//
+// Each case runs an optimized kernel and the path it replaces over the same
+// deterministic signal, block by block. It reports the processing time of both
+// per stereo frame and the peak difference of the outputs, which must stay
+// below the floor (exit code 1 otherwise). The default floor allows for float
+// rounding: a low cutoff filter in single precision already differs from its
+// double precision result by about -90 dBFS on full scale noise.
+//
+// The effect-* cases run a whole effect as on the pedal (cRenderer): block
+// Process() against the per-sample adapter ProcessSample().
+//
+// The kernel time is also given in host cycles per stereo frame (time stamp
+// counter on x86, or -g <GHz>); a case with a cycle budget fails above it.
+//
+// -q prints the quality of the delay line interpolators instead: gain at a
+// half sample delay and error of a modulated delay, for sines up to 20 kHz,
+// then the noise floor and footprint of the sample storages and the phase and
+// waveform error of the LFOs (cDCO).
+//
+// -m prints a model of the SDRAM accesses of a stereo modulated delay line,
+// per sample (Push / Pull) against block processing through the DTCM stage:
+// bus accesses and transactions (runs of ascending contiguous accesses, which
+// the FMC can issue as bursts) per stereo frame.
+//
+// -f prints the max error of the FastMath.h approximations against double
+// precision, and their time per call against the libm functions they replace.
+//
+// -c checks the int24 <-> float SAI conversion kernels (AudioConvert.h) against
+// the functions they replaced over every 24-bit code and edge floats, and times
+// both (exit code 1 on a mismatch).
+//
+// -b prints the per-callback overhead of each effect at block sizes 4 to 64
+// frames: SAI conversions and parameter smoothing (RTProcess) per frame,
+// against the effect Process, with the latency of one block.
+//
+// Copyright(c) 2025 Dad Design.
+//====================================================================================
+#include "HostPlatform.h"
+#include "TestSignals.h"
+#include "AudioBlock.h"
+#include "BiquadFilter.h"
+#include "cSVF.h"
+#include "cDelayLine.h"
+#include "cBlockDelayLine.h"
+#include "cDCOBank.h"
+#include "Tremolo.h"
+#include "Delay.h"
+#include "EffectTemplate.h"
+#include "FastMath.h"
+#include "cRenderer.h"
+#include "AudioConvert.h"
+#include <algorithm>
+#include <chrono>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <string>
+#include <vector>
+
+//***********************************************************************************
+// Cases
+//***********************************************************************************
+
+// Cycle budget of the 5 band stereo EQ kernel (7 sections), per stereo frame,
+// at every block size (4 to 64 frames). The kernel measures 45 to 95 cycles
+// per frame depending on the size and on the load of the host.
+constexpr float EQ_CYCLE_BUDGET = 150.0f;
+
+// --------------------------------------------------------------------------
+// Runs a path over the whole signal, in blocks of BlockSize frames
+using tRun = void (*)(const DadHost::cWavFile &In, DadHost::cWavFile &Out, size_t BlockSize, bool Reference);
+
+struct sBenchCase {
+	const char	*Name;
+	const char	*Kernel;		// Optimized kernel
+	const char	*ReferencePath;	// Path it replaces
+	tRun		Run;
+	bool		Checked;		// False: outputs differ by design (difference reported only)
+	float		CycleBudget;	// Host cycles per stereo frame of the kernel (0: none)
+};
+
+// --------------------------------------------------------------------------
+// cBiQuad: stereo block (TDF-II) against two Process(sample, eChannel) per frame
+template<DadDSP::FilterType Type, int Cutoff, int Gain>
+static void RunBiQuad(const DadHost::cWavFile &In, DadHost::cWavFile &Out, size_t BlockSize, bool Reference) {
+	DadDSP::cBiQuad Filter;
+	Filter.Initialize(SAMPLING_RATE, Cutoff, Gain, 1.0f, Type);
+
+	const size_t nFrames = In.getSize();
+	for(size_t Pos = 0; Pos < nFrames; Pos += BlockSize){
+		size_t Size = std::min(BlockSize, nFrames - Pos);
+		AudioBlock InBlock = AudioBlock::Planar(const_cast<float *>(&In.m_Left[Pos]), const_cast<float *>(&In.m_Right[Pos]), Size);
+		AudioBlock OutBlock = AudioBlock::Planar(&Out.m_Left[Pos], &Out.m_Right[Pos], Size);
+		if(Reference){
+			for(size_t Index = 0; Index < Size; Index++){
+				OutBlock.L(Index) = Filter.Process(InBlock.L(Index), DadDSP::eChannel::Left);
+				OutBlock.R(Index) = Filter.Process(InBlock.R(Index), DadDSP::eChannel::Right);
+			}
+		}else{
+			Filter.Process(InBlock, OutBlock);
+		}
+	}
+}
+
+// --------------------------------------------------------------------------
+// Tone knob sweep of the Delay (bass and treble filters of both delays, cutoff
+// changed every block as by the parameter callbacks): coefficients calculated
+// at 1 kHz and interpolated, against a calculation on every block
+static void RunToneSweep(const DadHost::cWavFile &In, DadHost::cWavFile &Out, size_t BlockSize, bool Reference) {
+	DadDSP::cBiQuad Bass[2], Treble[2];
+	for(int Delay = 0; Delay < 2; Delay++){
+		Bass[Delay].Initialize(SAMPLING_RATE, 600, 0.0f, 1.8f, DadDSP::FilterType::HPF);		// Knob positions at t = 0
+		Treble[Delay].Initialize(SAMPLING_RATE, 12000, 0.0f, 1.8f, DadDSP::FilterType::LPF);
+		Bass[Delay].setControlRate(Reference ? 0.0f : 1000.0f);
+		Treble[Delay].setControlRate(Reference ? 0.0f : 1000.0f);
+	}
+
+	const size_t nFrames = In.getSize();
+	for(size_t Pos = 0; Pos < nFrames; Pos += BlockSize){
+		size_t Size = std::min(BlockSize, nFrames - Pos);
+
+		// Knobs turning back and forth once per second
+		float Knob = std::fabs(std::fmod(Pos / static_cast<float>(SAMPLING_RATE), 2.0f) - 1.0f);
+		float BassFreq = 30.0f * std::exp(Knob * std::log(600.0f / 30.0f));
+		float TrebleFreq = 600.0f * std::exp(Knob * std::log(12000.0f / 600.0f));
+		for(int Delay = 0; Delay < 2; Delay++){
+			Bass[Delay].setCutoffFreq(BassFreq);
+			Treble[Delay].setCutoffFreq(TrebleFreq);
+			if(Reference){
+				Bass[Delay].CalculateParameters();
+				Treble[Delay].CalculateParameters();
+			}else{
+				Bass[Delay].UpdateParameters();
+				Treble[Delay].UpdateParameters();
+			}
+		}
+
+		AudioBlock InBlock = AudioBlock::Planar(const_cast<float *>(&In.m_Left[Pos]), const_cast<float *>(&In.m_Right[Pos]), Size);
+		AudioBlock OutBlock = AudioBlock::Planar(&Out.m_Left[Pos], &Out.m_Right[Pos], Size);
+		Bass[0].Process(InBlock, OutBlock);
+		Treble[0].Process(OutBlock, OutBlock);
+		Bass[1].Process(OutBlock, OutBlock);
+		Treble[1].Process(OutBlock, OutBlock);
+	}
+}
+
+// --------------------------------------------------------------------------
+// Q of the cSVF matching the bandwidth (octaves) of a cBiQuad at Cutoff
+static float BandwidthToQ(float Cutoff, float Bandwidth) {
+	float Omega = 2.0f * DadDSP::kPi * Cutoff / SAMPLING_RATE;
+	return 1.0f / (2.0f * std::sinh(DadDSP::kNaturalLog2 / 2.0f * Bandwidth * Omega / std::sin(Omega)));
+}
+
+// --------------------------------------------------------------------------
+// cSVF block against the cBiQuad block of the same response
+template<DadDSP::FilterType Type, DadDSP::eSVFOutput Output, int Cutoff>
+static void RunSVF(const DadHost::cWavFile &In, DadHost::cWavFile &Out, size_t BlockSize, bool Reference) {
+	DadDSP::cBiQuad BiQuad;
+	DadDSP::cSVF SVF;
+	BiQuad.Initialize(SAMPLING_RATE, Cutoff, 0.0f, 1.0f, Type);
+	SVF.Initialize(SAMPLING_RATE, Cutoff, BandwidthToQ(Cutoff, 1.0f), Output);
+
+	const size_t nFrames = In.getSize();
+	for(size_t Pos = 0; Pos < nFrames; Pos += BlockSize){
+		size_t Size = std::min(BlockSize, nFrames - Pos);
+		AudioBlock InBlock = AudioBlock::Planar(const_cast<float *>(&In.m_Left[Pos]), const_cast<float *>(&In.m_Right[Pos]), Size);
+		AudioBlock OutBlock = AudioBlock::Planar(&Out.m_Left[Pos], &Out.m_Right[Pos], Size);
+		if(Reference){
+			BiQuad.Process(InBlock, OutBlock);
+		}else{
+			SVF.Process(InBlock, OutBlock);
+		}
+	}
+}
+
+// --------------------------------------------------------------------------
+// Low pass swept by a 5 Hz LFO over 200 Hz - 5 kHz, cutoff of every frame:
+// cSVF modulated block against cBiQuad coefficients calculated on every frame
+static void RunSVFSweep(const DadHost::cWavFile &In, DadHost::cWavFile &Out, size_t BlockSize, bool Reference) {
+	const float Q = BandwidthToQ(1000.0f, 1.0f);
+	DadDSP::cBiQuad BiQuad;
+	DadDSP::cSVF SVF;
+	BiQuad.Initialize(SAMPLING_RATE, 200.0f, 0.0f, 1.0f, DadDSP::FilterType::LPF);
+	SVF.Initialize(SAMPLING_RATE, 200.0f, Q, DadDSP::eSVFOutput::LowPass);
+
+	float Cutoff[AUDIO_BUFFER_SIZE_MAX];
+	const float LFOStep = 2.0f * DadDSP::kPi * 5.0f / SAMPLING_RATE;
+	const float Depth = std::log(5000.0f / 200.0f);
+	const size_t nFrames = In.getSize();
+	for(size_t Pos = 0; Pos < nFrames; Pos += BlockSize){
+		size_t Size = std::min(BlockSize, nFrames - Pos);
+		for(size_t Index = 0; Index < Size; Index++){
+			float LFO = 0.5f - 0.5f * std::cos(LFOStep * static_cast<float>(Pos + Index));
+			Cutoff[Index] = 200.0f * std::exp(LFO * Depth);
+		}
+
+		AudioBlock InBlock = AudioBlock::Planar(const_cast<float *>(&In.m_Left[Pos]), const_cast<float *>(&In.m_Right[Pos]), Size);
+		AudioBlock OutBlock = AudioBlock::Planar(&Out.m_Left[Pos], &Out.m_Right[Pos], Size);
+		if(Reference){
+			for(size_t Index = 0; Index < Size; Index++){
+				BiQuad.setCutoffFreq(Cutoff[Index]);
+				BiQuad.CalculateParameters();
+				OutBlock.L(Index) = BiQuad.Process(InBlock.L(Index), DadDSP::eChannel::Left);
+				OutBlock.R(Index) = BiQuad.Process(InBlock.R(Index), DadDSP::eChannel::Right);
+			}
+		}else{
+			SVF.Process(InBlock, OutBlock, Cutoff);
+		}
+	}
+}
+
+// --------------------------------------------------------------------------
+// 5 band stereo EQ (low cut, low shelf, 3 peaking bands, high shelf, high cut,
+// as cParametricEQ): one cBiQuadCascade against one cBiQuad block per section
+static void RunEQ(const DadHost::cWavFile &In, DadHost::cWavFile &Out, size_t BlockSize, bool Reference) {
+	DadDSP::cBiQuadCascade EQ;
+	EQ.Initialize(SAMPLING_RATE);
+	EQ.addSection(80.0f, 0.0f, 1.9f, DadDSP::FilterType::HPF);
+	EQ.addSection(120.0f, 4.0f, 1.0f, DadDSP::FilterType::LSH);
+	EQ.addSection(300.0f, -3.0f, 1.0f, DadDSP::FilterType::PEQ);
+	EQ.addSection(1200.0f, 5.0f, 0.7f, DadDSP::FilterType::PEQ);
+	EQ.addSection(3500.0f, -6.0f, 1.5f, DadDSP::FilterType::PEQ);
+	EQ.addSection(7000.0f, 2.0f, 1.0f, DadDSP::FilterType::HSH);
+	EQ.addSection(15000.0f, 0.0f, 1.9f, DadDSP::FilterType::LPF);
+
+	const size_t nFrames = In.getSize();
+	for(size_t Pos = 0; Pos < nFrames; Pos += BlockSize){
+		size_t Size = std::min(BlockSize, nFrames - Pos);
+		AudioBlock InBlock = AudioBlock::Planar(const_cast<float *>(&In.m_Left[Pos]), const_cast<float *>(&In.m_Right[Pos]), Size);
+		AudioBlock OutBlock = AudioBlock::Planar(&Out.m_Left[Pos], &Out.m_Right[Pos], Size);
+		if(Reference){
+			EQ.getSection(0).Process(InBlock, OutBlock);
+			for(uint8_t Section = 1; Section < EQ.getNbSections(); Section++){
+				EQ.getSection(Section).Process(OutBlock, OutBlock);
+			}
+		}else{
+			EQ.Process(InBlock, OutBlock);
+		}
+	}
+}
+
+// --------------------------------------------------------------------------
+// Stereo feedback delay of 500 ms as the Delay effect (all the frames of the
+// block read, then written): cBlockDelayLine against cDelayLine Pull / Push.
+// Modulated: 2 ms triangle modulation at 0.5 Hz, reads interpolated by
+// tInterpolator (the reference stays linear). tStorage: samples of the block
+// line (the reference stays float).
+template<typename tInterpolator, bool Modulated, typename tStorage = DadDSP::cFloatStorage>
+static void RunDelayLine(const DadHost::cWavFile &In, DadHost::cWavFile &Out, size_t BlockSize, bool Reference) {
+	using tBlockLine = DadDSP::cBlockDelayLine<tInterpolator, tStorage>;
+	constexpr uint32_t Size = 48000;
+	static std::vector<float> Memory[2];
+	static std::vector<typename tBlockLine::tCell> Cells[2];
+	DadDSP::cDelayLine Line[2];
+	tBlockLine BlockLine[2];
+	for(int Channel = 0; Channel < 2; Channel++){
+		if(Reference){
+			Memory[Channel].assign(Size + 5, 0.0f);
+			Line[Channel].Initialize(Memory[Channel].data(), Size);
+		}else{
+			const uint32_t Capacity = tBlockLine::getCapacity(Size);
+			Cells[Channel].assign(tBlockLine::getCells(Capacity), 0);
+			BlockLine[Channel].Initialize(Cells[Channel].data(), Capacity);
+		}
+	}
+
+	const float Delay = 0.5f * SAMPLING_RATE;
+	const float Depth = 0.002f * SAMPLING_RATE;
+	const float LFOStep = 2.0f * 0.5f / SAMPLING_RATE;
+	float Phase = 0.0f;
+	float Delays[AUDIO_BUFFER_SIZE_MAX];
+	float Wet[2][AUDIO_BUFFER_SIZE_MAX];
+	const size_t nFrames = In.getSize();
+	for(size_t Pos = 0; Pos < nFrames; Pos += BlockSize){
+		size_t Size = std::min(BlockSize, nFrames - Pos);
+		for(size_t Index = 0; Index < Size; Index++){
+			Phase = (Phase < 2.0f) ? Phase + LFOStep : Phase + LFOStep - 2.0f;
+			Delays[Index] = Modulated ? Delay - (std::fabs(Phase - 1.0f) * Depth) : Delay;
+		}
+		const float *pIn[2] = {&In.m_Left[Pos], &In.m_Right[Pos]};
+		float *pOut[2] = {&Out.m_Left[Pos], &Out.m_Right[Pos]};
+		for(int Channel = 0; Channel < 2; Channel++){
+			if(Reference){
+				for(size_t Index = 0; Index < Size; Index++){
+					Wet[Channel][Index] = Modulated ? Line[Channel].Pull(Delays[Index] - Index)
+					                                : Line[Channel].Pull(static_cast<int32_t>(Delays[Index]) - static_cast<int32_t>(Index));
+				}
+			}else if(Modulated){
+				BlockLine[Channel].Read(Wet[Channel], Delays, Size);
+			}else{
+				BlockLine[Channel].Read(Wet[Channel], static_cast<uint32_t>(Delay), Size);
+			}
+			for(size_t Index = 0; Index < Size; Index++){
+				pOut[Channel][Index] = pIn[Channel][Index] + 0.5f * Wet[Channel][Index];
+			}
+			if(Reference){
+				for(size_t Index = 0; Index < Size; Index++){
+					Line[Channel].Push(pOut[Channel][Index]);
+				}
+			}else{
+				BlockLine[Channel].Write(pOut[Channel], Size);
+			}
+		}
+	}
+}
+
+// --------------------------------------------------------------------------
+// Delay read stage: 8 rhythmic taps of a modulated stereo line gathered by
+// cBlockDelayLine::ReadTaps (Hermite, as the Delay multi-tap mode) against
+// the 4 Pull per frame of the dual delay on cDelayLine (2 delays x 2 channels)
+static void RunMultiTap(const DadHost::cWavFile &In, DadHost::cWavFile &Out, size_t BlockSize, bool Reference) {
+	constexpr uint32_t Size = 48000;
+	constexpr size_t NbTaps = 8;
+	static std::vector<float> Memory[4];
+	DadDSP::cDelayLine Line[4];
+	DadDSP::cBlockDelayLine<DadDSP::cHermiteInterpolator> BlockLine[2];
+	for(int Channel = 0; Channel < 4; Channel++){
+		if(Reference){
+			Memory[Channel].assign(Size + 5, 0.0f);
+			Line[Channel].Initialize(Memory[Channel].data(), Size);
+		}else if(Channel < 2){
+			Memory[Channel].assign(DadDSP::cBlockDelayLine<DadDSP::cHermiteInterpolator>::getCapacity(Size), 0.0f);
+			BlockLine[Channel].Initialize(Memory[Channel].data(), Memory[Channel].size());
+		}
+	}
+
+	const float Delay = 0.5f * SAMPLING_RATE;
+	const float Depth = 0.002f * SAMPLING_RATE;
+	const float LFOStep = 2.0f * 0.5f / SAMPLING_RATE;
+	uint32_t Taps[NbTaps];
+	float Gains[NbTaps];
+	for(size_t Tap = 0; Tap < NbTaps; Tap++){
+		Taps[Tap] = static_cast<uint32_t>(Delay * (Tap + 1) / NbTaps - Depth);
+		Gains[Tap] = (Tap & 1) ? 0.6f : 0.35f;
+	}
+	float Phase = 0.0f;
+	float Modulation[AUDIO_BUFFER_SIZE_MAX];
+	float Wet[AUDIO_BUFFER_SIZE_MAX];
+	const size_t nFrames = In.getSize();
+	for(size_t Pos = 0; Pos < nFrames; Pos += BlockSize){
+		size_t Size = std::min(BlockSize, nFrames - Pos);
+		for(size_t Index = 0; Index < Size; Index++){
+			Phase = (Phase < 2.0f) ? Phase + LFOStep : Phase + LFOStep - 2.0f;
+			Modulation[Index] = Depth - (std::fabs(Phase - 1.0f) * Depth);
+		}
+		const float *pIn[2] = {&In.m_Left[Pos], &In.m_Right[Pos]};
+		float *pOut[2] = {&Out.m_Left[Pos], &Out.m_Right[Pos]};
+		for(int Channel = 0; Channel < 2; Channel++){
+			if(Reference){
+				for(size_t Index = 0; Index < Size; Index++){
+					float Time = Delay - Depth + Modulation[Index] - Index;
+					Wet[Index] = Line[Channel].Pull(Time) + Line[Channel + 2].Pull(0.375f * Time);
+				}
+			}else{
+				BlockLine[Channel].ReadTaps(Wet, Modulation, Taps, Gains, NbTaps, Size);
+			}
+			for(size_t Index = 0; Index < Size; Index++){
+				pOut[Channel][Index] = pIn[Channel][Index] + 0.5f * Wet[Index];
+			}
+			if(Reference){
+				for(size_t Index = 0; Index < Size; Index++){
+					Line[Channel].Push(pOut[Channel][Index]);
+					Line[Channel + 2].Push(pOut[Channel][Index]);
+				}
+			}else{
+				BlockLine[Channel].Write(pOut[Channel], Size);
+			}
+		}
+	}
+}
+
+// --------------------------------------------------------------------------
+// cDCO before the phase accumulator (float phase, sin() and fmod() per
+// sample): reference of the dco cases
+class cFloatDCO {
+public:
+	void Initialize(float SampleRate, float Frequency, float DutyCycle) {
+		m_Value = 0.0f;
+		m_Step = Frequency / SampleRate;
+		m_DutyCycle = 0.1f + (0.8f * DutyCycle);
+	}
+	inline void Step() {
+		m_Value += m_Step;
+		if(m_Value > 1.0f){
+			m_Value -= 1.0f;
+		}
+	}
+	inline float getSquareModValue() {
+		constexpr float riseTime = 0.04f;
+		if(m_Value > (m_DutyCycle + riseTime)){
+			return 0;
+		}else if(m_Value > m_DutyCycle){
+			return 1 - ((m_Value - m_DutyCycle) / riseTime);
+		}else if(m_Value > riseTime){
+			return 1;
+		}else{
+			return (m_Value / riseTime);
+		}
+	}
+	inline float getTriangleValue() {
+		return (m_Value > 0.5f) ? 2 - (m_Value * 2) : (m_Value * 2);
+	}
+	inline float getTriangleValuePhased(float PhaseShift) {
+		float t = fmod(m_Value + PhaseShift, 1.0f);
+		if(t < 0.0f) t += 1.0f;
+		return (t > 0.5f) ? 2.0f - (t * 2.0f) : t * 2.0f;
+	}
+	inline float getTriangleModValue() {
+		return (m_Value > m_DutyCycle) ? (1 - m_Value) / (1 - m_DutyCycle) : (m_Value / m_DutyCycle);
+	}
+	inline float getSineValue() {
+		return 0.5f + (sin((6.28318530717959F * m_Value) + 1.5707963267949F) / 2.0f);
+	}
+	inline float getRectifiedSineValue() {
+		return sin(3.14159265358979F * m_Value);
+	}
+	inline float getPosition() const { return m_Value; }
+
+private:
+	float m_Value = 0.0f;
+	float m_Step = 0.0f;
+	float m_DutyCycle = 0.5f;
+};
+
+// --------------------------------------------------------------------------
+// LFO outputs of the effects, left / right (the input only gives the length):
+//  0: triangle / triangle phased by 1/4 (Delay)
+//  1: sine / rectified sine (Tremolo vibrato)
+//  2: square / triangle with duty cycle (Tremolo volume)
+// The frequency (SAMPLING_RATE / 2^16) is a step both phases add exactly.
+enum class eDCOShape { Triangle, Sine, Duty };
+
+template<typename tDCO, eDCOShape Shape>
+static void ProcessDCO(tDCO &DCO, DadHost::cWavFile &Out) {
+	for(size_t Index = 0; Index < Out.getSize(); Index++){
+		DCO.Step();
+		if(Shape == eDCOShape::Triangle){
+			Out.m_Left[Index] = DCO.getTriangleValue();
+			Out.m_Right[Index] = DCO.getTriangleValuePhased(0.25f);
+		}else if(Shape == eDCOShape::Sine){
+			Out.m_Left[Index] = DCO.getSineValue();
+			Out.m_Right[Index] = DCO.getRectifiedSineValue();
+		}else{
+			Out.m_Left[Index] = DCO.getSquareModValue();
+			Out.m_Right[Index] = DCO.getTriangleModValue();
+		}
+	}
+}
+
+template<eDCOShape Shape>
+static void RunDCO(const DadHost::cWavFile &In, DadHost::cWavFile &Out, size_t BlockSize, bool Reference) {
+	constexpr float Frequency = SAMPLING_RATE / 65536.0f;
+	if(Reference){
+		cFloatDCO DCO;
+		DCO.Initialize(SAMPLING_RATE, Frequency, 0.3f);
+		ProcessDCO<cFloatDCO, Shape>(DCO, Out);
+	}else{
+		DadDSP::cDCO DCO;
+		DCO.Initialize(SAMPLING_RATE, 0.0f, Frequency, Frequency, 0.3f);
+		ProcessDCO<DadDSP::cDCO, Shape>(DCO, Out);
+	}
+}
+
+// --------------------------------------------------------------------------
+// N detuned LFOs spread over a period (chorus voices): sum of the sines left,
+// of the triangles right. cDCOBank<N> against N cDCO.
+template<size_t N>
+static void RunDCOBank(const DadHost::cWavFile &In, DadHost::cWavFile &Out, size_t BlockSize, bool Reference) {
+	DadDSP::cDCO DCO[N];
+	DadDSP::cDCOBank<N> Bank;
+	Bank.Initialize(SAMPLING_RATE, 0.0f, 0.5f, 0.5f, 0.5f);
+	Bank.setSpread(1.0f);
+	for(size_t Osc = 0; Osc < N; Osc++){
+		const float Frequency = 0.5f + 0.05f * Osc;
+		DCO[Osc].Initialize(SAMPLING_RATE, 0.0f, Frequency, Frequency, 0.5f);
+		DCO[Osc].setPosition(Bank.getPosition(Osc));
+		Bank.setFreq(Osc, Frequency);
+	}
+
+	float Sines[N];
+	float Triangles[N];
+	for(size_t Index = 0; Index < Out.getSize(); Index++){
+		if(Reference){
+			for(size_t Osc = 0; Osc < N; Osc++){
+				DCO[Osc].Step();
+				Sines[Osc] = DCO[Osc].getSineValue();
+				Triangles[Osc] = DCO[Osc].getTriangleValue();
+			}
+		}else{
+			Bank.StepSineValues(Sines);
+			Bank.getTriangleValues(Triangles);
+		}
+		float Left = 0.0f;
+		float Right = 0.0f;
+		for(size_t Osc = 0; Osc < N; Osc++){
+			Left += Sines[Osc];
+			Right += Triangles[Osc];
+		}
+		Out.m_Left[Index] = Left / N;
+		Out.m_Right[Index] = Right / N;
+	}
+}
+
+// --------------------------------------------------------------------------
+// Tremolo volume modulation of a stereo LFO at 80 % depth, on the signal:
+// cTremoloGain (depth constants set once; triangle: table curve, one call per
+// block and channel; square: per frame as the LFO steps) against the per frame
+// path it replaces (depth sine per block, curve sine and shape switch per frame)
+template<bool Square>
+static void RunTremoloGain(const DadHost::cWavFile &In, DadHost::cWavFile &Out, size_t BlockSize, bool Reference) {
+	using namespace DadEffect;
+	constexpr float Depth = 80.0f;
+	DadDSP::cDCOBank<LFO_COUNT> LFO;
+	LFO.Initialize(SAMPLING_RATE, 0.0f, 7.0f, 7.0f, 0.3f);
+	LFO.setPosition(LFO_RIGHT, 0.5f);
+	cTremoloGain Gain;
+	Gain.setDepth(Depth);
+	const uint32_t Shape = Square ? 1 : 0;
+
+	float Left[AUDIO_BUFFER_SIZE_MAX];
+	float Right[AUDIO_BUFFER_SIZE_MAX];
+	for(size_t Pos = 0; Pos < In.getSize(); Pos += BlockSize){
+		const size_t Size = std::min(BlockSize, In.getSize() - Pos);
+		if(Reference){
+			const float TremoloDeep = DadDSP::FastSin((Depth / 100.0f) * M_PI / 2.0f);
+			for(size_t Index = 0; Index < Size; Index++){
+				float Shapes[LFO_COUNT];
+				LFO.Step();
+				if(Shape == 0){
+					LFO.getTriangleModValues(Shapes);
+					Left[Index] = DadDSP::FastSin(1 - ((TremoloDeep)*(1-Shapes[LFO_LEFT]))* M_PI / 2.0f);
+					Right[Index] = DadDSP::FastSin(1 - ((TremoloDeep)*(1-Shapes[LFO_RIGHT]))* M_PI / 2.0f);
+				}else if(Shape == 1){
+					LFO.getSquareModValues(Shapes);
+					Left[Index] = 1 - ((TremoloDeep)*(1-Shapes[LFO_LEFT]));
+					Right[Index] = 1 - ((TremoloDeep)*(1-Shapes[LFO_RIGHT]));
+				}
+			}
+		}else{
+			for(size_t Index = 0; Index < Size; Index++){
+				float Shapes[LFO_COUNT];
+				LFO.Step();
+				if(Square){
+					LFO.getSquareModValues(Shapes);
+					Left[Index] = Gain.Square(Shapes[LFO_LEFT]);
+					Right[Index] = Gain.Square(Shapes[LFO_RIGHT]);
+				}else{
+					LFO.getTriangleModValues(Shapes);
+					Left[Index] = Shapes[LFO_LEFT];
+					Right[Index] = Shapes[LFO_RIGHT];
+				}
+			}
+			if(!Square){
+				Gain.Triangle(Left, Left, Size);
+				Gain.Triangle(Right, Right, Size);
+			}
+		}
+		for(size_t Index = 0; Index < Size; Index++){
+			Out.m_Left[Pos + Index] = In.m_Left[Pos + Index] * Left[Index];
+			Out.m_Right[Pos + Index] = In.m_Right[Pos + Index] * Right[Index];
+		}
+	}
+}
+
+// --------------------------------------------------------------------------
+// Effects: block Process() against the per-sample adapter (ProcessSample once
+// per frame through ProcessInterleaved), as run on the pedal by cRenderer.
+// Each run creates the effect in a new renderer and settles its parameters;
+// only the render is timed (see TimeRun).
+static double __RenderTime = -1.0;			// Render time of the last effect run (s)
+
+template<typename T>
+class cPerSampleEffect : public DadHost::cHostEffect<T> {
+public:
+	void Process(const AudioBlock &In, const AudioBlock &Out) override { ProcessInterleaved(this->m_Effect, In, Out); }
+};
+
+template<typename T>
+static DadHost::iHostEffect *CreateBlockEffect() {
+	return new DadHost::cHostEffect<T>;
+}
+
+template<typename T>
+static DadHost::iHostEffect *CreatePerSampleEffect() {
+	return new cPerSampleEffect<T>;
+}
+
+static void RenderEffect(const DadHost::sHostEffect &Effect, const DadHost::cWavFile &In, DadHost::cWavFile &Out) {
+	DadHost::cRenderer Renderer;
+	Renderer.Init(Effect);
+	Renderer.Settle(5.0f);
+	__RenderTime = Renderer.Render(In, Out);
+}
+
+template<typename T, uint32_t SerializeID>
+static void RunEffect(const DadHost::cWavFile &In, DadHost::cWavFile &Out, size_t BlockSize, bool Reference) {
+	static const DadHost::sHostEffect Block = {"block", SerializeID, CreateBlockEffect<T>};
+	static const DadHost::sHostEffect PerSample = {"per-sample", SerializeID, CreatePerSampleEffect<T>};
+	RenderEffect(Reference ? PerSample : Block, In, Out);
+}
+
+static const sBenchCase __BenchCases[] = {
+	{"biquad-lpf",		"cBiQuad block",	"per sample",	RunBiQuad<DadDSP::FilterType::LPF, 1000, 0>, true, 0},
+	{"biquad-lpf24",	"cBiQuad block",	"per sample",	RunBiQuad<DadDSP::FilterType::LPF24, 1000, 0>, true, 0},
+	{"biquad-hpf",		"cBiQuad block",	"per sample",	RunBiQuad<DadDSP::FilterType::HPF, 100, 0>, true, 0},
+	{"biquad-peq",		"cBiQuad block",	"per sample",	RunBiQuad<DadDSP::FilterType::PEQ, 800, 9>, true, 0},
+	{"tone-sweep",		"1 kHz control rate", "every block", RunToneSweep, false, 0},
+	{"svf-lpf",			"cSVF block",		"cBiQuad block", RunSVF<DadDSP::FilterType::LPF, DadDSP::eSVFOutput::LowPass, 1000>, true, 0},
+	{"svf-hpf",			"cSVF block",		"cBiQuad block", RunSVF<DadDSP::FilterType::HPF, DadDSP::eSVFOutput::HighPass, 100>, true, 0},
+	{"svf-notch",		"cSVF block",		"cBiQuad block", RunSVF<DadDSP::FilterType::NOTCH, DadDSP::eSVFOutput::Notch, 1000>, true, 0},
+	{"svf-sweep",		"cSVF modulated",	"cBiQuad every frame", RunSVFSweep, false, 0},
+	{"eq-5band",		"cBiQuadCascade",	"cBiQuad blocks", RunEQ, true, EQ_CYCLE_BUDGET},
+	{"delay-fixed",		"cBlockDelayLine",	"cDelayLine",	RunDelayLine<DadDSP::cLinearInterpolator, false>, true, 0},
+	{"delay-mod",		"cBlockDelayLine",	"cDelayLine",	RunDelayLine<DadDSP::cLinearInterpolator, true>, true, 0},
+	{"delay-hermite",	"Hermite read",		"cDelayLine linear", RunDelayLine<DadDSP::cHermiteInterpolator, true>, false, 0},
+	{"delay-lagrange",	"Lagrange read",	"cDelayLine linear", RunDelayLine<DadDSP::cLagrangeInterpolator, true>, false, 0},
+	{"delay-allpass",	"allpass read",		"cDelayLine linear", RunDelayLine<DadDSP::cAllpassInterpolator, true>, false, 0},
+	{"delay-taps",		"8 taps ReadTaps",	"4 Pull / frame", RunMultiTap, false, 0},
+	{"delay-int16",		"int16 storage",	"cDelayLine float", RunDelayLine<DadDSP::cLinearInterpolator, false, DadDSP::cInt16Storage>, true, 0},
+	{"delay-int24",		"packed int24",		"cDelayLine float", RunDelayLine<DadDSP::cLinearInterpolator, false, DadDSP::cInt24Storage>, true, 0},
+	{"delay-int24-mod",	"int24 Hermite read", "cDelayLine linear", RunDelayLine<DadDSP::cHermiteInterpolator, true, DadDSP::cInt24Storage>, false, 0},
+	{"dco-triangle",	"uint32 phase",		"float phase, fmod", RunDCO<eDCOShape::Triangle>, true, 0},
+	{"dco-sine",		"sine table",		"float phase, sin", RunDCO<eDCOShape::Sine>, true, 0},
+	{"dco-duty",		"uint32 phase",		"float phase",	RunDCO<eDCOShape::Duty>, true, 0},
+	{"dco-bank-2",		"cDCOBank<2>",		"2 cDCO",		RunDCOBank<2>, true, 0},
+	{"dco-bank-8",		"cDCOBank<8>",		"8 cDCO",		RunDCOBank<8>, true, 0},
+	{"dco-bank-16",		"cDCOBank<16>",		"16 cDCO",		RunDCOBank<16>, true, 0},
+	{"dco-bank-64",		"cDCOBank<64>",		"64 cDCO",		RunDCOBank<64>, true, 0},
+	{"tremolo-triangle",	"cTremoloGain table",	"sine per frame",	RunTremoloGain<false>, true, 0},
+	{"tremolo-square",	"cTremoloGain",		"switch per frame",	RunTremoloGain<true>, true, 0},
+	{"effect-delay",	"cDelay block",		"ProcessSample",	RunEffect<DadEffect::cDelay, DelaySerializeID>, true, 0},
+	{"effect-tremolo",	"cTremolo block",	"ProcessSample",	RunEffect<DadEffect::cTremolo, TremoloSerializeID>, true, 0},
+	{"effect-template",	"cEffectTemplate block", "ProcessSample", RunEffect<DadEffect::cEffectTemplate, EffectTemplateSerializeID>, true, 0},
+};
+
+//***********************************************************************************
+// Measure
+//***********************************************************************************
+
+// --------------------------------------------------------------------------
+// Best time of several runs (seconds), at least MinTime seconds in total.
+// Effect cases report their render time, without the effect initialization.
+static double TimeRun(tRun Run, const DadHost::cWavFile &In, DadHost::cWavFile &Out, size_t BlockSize, bool Reference) {
+	const double MinTime = 0.3;
+	double Best = 1e30;
+	double Total = 0.0;
+	for(int Pass = 0; (Pass < 3) || (Total < MinTime); Pass++){
+		__RenderTime = -1.0;
+		auto Start = std::chrono::steady_clock::now();
+		Run(In, Out, BlockSize, Reference);
+		auto End = std::chrono::steady_clock::now();
+		double Time = (__RenderTime >= 0.0) ? __RenderTime : std::chrono::duration<double>(End - Start).count();
+		Best = std::min(Best, Time);
+		Total += Time;
+	}
+	return Best;
+}
+
+// --------------------------------------------------------------------------
+// Host cycles per nanosecond (time stamp counter, 0 if none)
+static double CyclesPerNs() {
+#if defined(__x86_64__) || defined(__i386__)
+	auto Start = std::chrono::steady_clock::now();
+	unsigned long long StartTicks = __rdtsc();
+	double Time;
+	do{
+		Time = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - Start).count();
+	}while(Time < 50e6);
+	return static_cast<double>(__rdtsc() - StartTicks) / Time;
+#else
+	return 0.0;
+#endif
+}
+
+// --------------------------------------------------------------------------
+// Peak difference in dBFS
+static double PeakDifference(const DadHost::cWavFile &A, const DadHost::cWavFile &B) {
+	double Peak = 0.0;
+	for(size_t Index = 0; Index < A.getSize(); Index++){
+		Peak = std::max(Peak, static_cast<double>(std::fabs(A.m_Left[Index] - B.m_Left[Index])));
+		Peak = std::max(Peak, static_cast<double>(std::fabs(A.m_Right[Index] - B.m_Right[Index])));
+	}
+	return (Peak > 1e-10) ? 20.0 * std::log10(Peak) : -200.0;
+}
+
+// --------------------------------------------------------------------------
+// Interpolator quality at Freq (dB), one sine through a cBlockDelayLine:
+//  - Modulated false: gain at a constant delay of 100.5 samples (the worst
+//    fraction for the magnitude)
+//  - Modulated true : error against the ideal output of a delay swept over
+//    100 +/- 20 samples at 2 Hz (aliasing and interpolation noise), relative
+//    to the signal
+template<typename tInterpolator>
+static double MeasureInterpolator(double Freq, bool Modulated) {
+	constexpr size_t Length = 48000;
+	constexpr size_t Settle = 4800;
+	std::vector<float> Memory(DadDSP::cBlockDelayLine<tInterpolator>::getCapacity(200), 0.0f);
+	DadDSP::cBlockDelayLine<tInterpolator> Line;
+	Line.Initialize(Memory.data(), Memory.size());
+
+	const double Omega = 2.0 * M_PI * Freq / SAMPLING_RATE;
+	double Signal = 0.0, Error = 0.0, Output = 0.0;
+	for(size_t Frame = 0; Frame < Length; Frame++){
+		double Delay = Modulated ? 100.0 + 20.0 * std::sin(2.0 * M_PI * 2.0 * Frame / SAMPLING_RATE) : 100.5;
+		Line.Push(static_cast<float>(std::sin(Omega * Frame)));
+		double Sample = Line.Pull(static_cast<float>(Delay));
+		if(Frame >= Settle){
+			double Ideal = std::sin(Omega * (Frame - Delay));
+			Signal += Ideal * Ideal;
+			Error += (Sample - Ideal) * (Sample - Ideal);
+			Output += Sample * Sample;
+		}
+	}
+	return 10.0 * std::log10((Modulated ? Error + 1e-30 : Output) / Signal);
+}
+
+// --------------------------------------------------------------------------
+// Quality table of the delay line interpolators
+static void ReportInterpolators() {
+	static const double Freqs[] = {1000.0, 5000.0, 10000.0, 15000.0, 20000.0};
+	struct sInterpolator {
+		const char	*Name;
+		double		(*Measure)(double Freq, bool Modulated);
+	};
+	static const sInterpolator Interpolators[] = {
+		{"linear",		MeasureInterpolator<DadDSP::cLinearInterpolator>},
+		{"hermite",		MeasureInterpolator<DadDSP::cHermiteInterpolator>},
+		{"lagrange",	MeasureInterpolator<DadDSP::cLagrangeInterpolator>},
+		{"allpass",		MeasureInterpolator<DadDSP::cAllpassInterpolator>},
+	};
+
+	printf("gain at a 0.5 sample fraction (dB) | error of a modulated delay (dB)\n");
+	printf("%-10s", "freq (Hz)");
+	for(int Pass = 0; Pass < 2; Pass++){
+		for(double Freq : Freqs){
+			printf(" %7.0f", Freq);
+		}
+		printf(Pass == 0 ? " |" : "\n");
+	}
+	for(const sInterpolator &Interpolator : Interpolators){
+		printf("%-10s", Interpolator.Name);
+		for(int Pass = 0; Pass < 2; Pass++){
+			for(double Freq : Freqs){
+				printf(" %7.1f", Interpolator.Measure(Freq, Pass == 1));
+			}
+			printf(Pass == 0 ? " |" : "\n");
+		}
+	}
+}
+
+// --------------------------------------------------------------------------
+// Noise floor of a delay line storage (dBFS): error of a full scale sine
+// written to the line and read back at a fixed delay
+template<typename tStorage>
+static double MeasureStorage() {
+	using tLine = DadDSP::cBlockDelayLine<DadDSP::cLinearInterpolator, tStorage>;
+	constexpr size_t Length = 48000;
+	const uint32_t Capacity = tLine::getCapacity(200);
+	std::vector<typename tLine::tCell> Cells(tLine::getCells(Capacity), 0);
+	tLine Line;
+	Line.Initialize(Cells.data(), Capacity);
+
+	const double Omega = 2.0 * M_PI * 997.0 / SAMPLING_RATE;
+	double Error = 0.0;
+	for(size_t Frame = 0; Frame < Length; Frame++){
+		Line.Push(static_cast<float>(std::sin(Omega * Frame)));
+		if(Frame >= 100){
+			double Sample = Line.Pull(static_cast<int32_t>(100));
+			double Ideal = static_cast<float>(std::sin(Omega * (Frame - 100)));
+			Error += (Sample - Ideal) * (Sample - Ideal);
+		}
+	}
+	return 10.0 * std::log10((Error / (Length - 100)) + 1e-30);
+}
+
+// --------------------------------------------------------------------------
+// Noise floor and footprint of the delay line storages
+static void ReportStorages() {
+	struct sStorage {
+		const char	*Name;
+		double		BytesPerSample;
+		double		(*Measure)();
+	};
+	static const sStorage Storages[] = {
+		{"float",	4.0,	MeasureStorage<DadDSP::cFloatStorage>},
+		{"int16",	2.0,	MeasureStorage<DadDSP::cInt16Storage>},
+		{"int24",	3.0,	MeasureStorage<DadDSP::cInt24Storage>},
+	};
+
+	printf("%-10s %10s %16s %18s\n", "storage", "bytes/smp", "noise (dB rms)", "stereo s per MB");
+	for(const sStorage &Storage : Storages){
+		printf("%-10s %10.0f %16.1f %18.2f\n", Storage.Name, Storage.BytesPerSample, Storage.Measure(),
+			   1048576.0 / (2.0 * Storage.BytesPerSample * SAMPLING_RATE));
+	}
+}
+
+// --------------------------------------------------------------------------
+// Phase error of the LFOs (in periods) against a double precision phase,
+// after Seconds at Frequency: float accumulator against cDCO
+static void ReportDCO() {
+	static const float Frequencies[] = {0.5f, 0.7f, 3.0f, 9.0f};
+	constexpr double Seconds = 600.0;
+	printf("LFO phase error after %.0f s (periods) | sine error (dB)\n", Seconds);
+	printf("%-10s %12s %12s | %8s %8s\n", "freq (Hz)", "float", "cDCO", "float", "cDCO");
+	for(float Frequency : Frequencies){
+		cFloatDCO Float;
+		DadDSP::cDCO DCO;
+		Float.Initialize(SAMPLING_RATE, Frequency, 0.5f);
+		DCO.Initialize(SAMPLING_RATE, 0.0f, Frequency, Frequency, 0.5f);
+		const size_t Steps = static_cast<size_t>(Seconds * SAMPLING_RATE);
+		double FloatSine = 0.0, DCOSine = 0.0;
+		for(size_t Step = 1; Step <= Steps; Step++){
+			Float.Step();
+			DCO.Step();
+			if(Step <= static_cast<size_t>(SAMPLING_RATE)){
+				// Waveform error over the first second
+				double Ideal = 0.5 + 0.5 * std::cos(2.0 * M_PI * Frequency * Step / SAMPLING_RATE);
+				FloatSine = std::max(FloatSine, std::fabs(Float.getSineValue() - Ideal));
+				DCOSine = std::max(DCOSine, std::fabs(DCO.getSineValue() - Ideal));
+			}
+		}
+		double Ideal = std::fmod(static_cast<double>(Frequency) * Steps / SAMPLING_RATE, 1.0);
+		auto Error = [Ideal](double Position) {
+			double Error = std::fabs(Position - Ideal);
+			return std::min(Error, 1.0 - Error);
+		};
+		printf("%-10.1f %12.2e %12.2e | %8.1f %8.1f\n", Frequency, Error(Float.getPosition()), Error(DCO.getPosition()),
+			   20.0 * std::log10(FloatSine + 1e-12), 20.0 * std::log10(DCOSine + 1e-12));
+	}
+}
+
+// --------------------------------------------------------------------------
+// SDRAM access model: accesses to the ring buffers (Begin..End) are counted,
+// an access contiguous to the previous one (Next) extends its transaction
+struct sAccessModel {
+	uintptr_t	Begin = 0;
+	uintptr_t	End = 0;
+	uintptr_t	Next = 0;
+	size_t		Accesses = 0;		// Bus accesses
+	size_t		Transactions = 0;	// Runs of contiguous accesses
+	size_t		Singles = 0;		// Transactions of a single access
+	size_t		Run = 0;			// Accesses of the current transaction
+
+	void Record(const void *pAddress, size_t Bytes) {
+		uintptr_t Address = reinterpret_cast<uintptr_t>(pAddress);
+		if((Address < Begin) || (Address >= End)){
+			return;					// DTCM stage or caller buffers
+		}
+		if(Address != Next){
+			Singles += (Run == 1) ? 1 : 0;
+			Transactions++;
+			Run = 0;
+		}
+		Accesses++;
+		Run++;
+		Next = Address + Bytes;
+	}
+	void Close() { Singles += (Run == 1) ? 1 : 0; Run = 0; Next = 0; }
+};
+static sAccessModel __AccessModel;
+
+// --------------------------------------------------------------------------
+// Storage policy counting the accesses of tBase: a sample load is one access,
+// a store one access per cell, a cell copy one access per 32 bit word
+template<typename tBase>
+class cCountedStorage {
+public:
+	using tCell = typename tBase::tCell;
+	static constexpr uint32_t kCellsPerSample = tBase::kCellsPerSample;
+	static constexpr bool kDirectWrite = tBase::kDirectWrite;
+
+	static constexpr size_t getCells(uint32_t Capacity) { return tBase::getCells(Capacity); }
+
+	static inline float Load(const tCell *pBuffer, uint32_t Index) {
+		__AccessModel.Record(&pBuffer[Index * kCellsPerSample], kCellsPerSample * sizeof(tCell));
+		return tBase::Load(pBuffer, Index);
+	}
+	static inline void Store(tCell *pBuffer, uint32_t Index, float Sample) {
+		for(uint32_t Cell = 0; Cell < kCellsPerSample; Cell++){
+			__AccessModel.Record(&pBuffer[(Index * kCellsPerSample) + Cell], sizeof(tCell));
+		}
+		tBase::Store(pBuffer, Index, Sample);
+	}
+	static inline void CopyCells(tCell *pDest, const tCell *pSource, size_t Count) {
+		const size_t Bytes = Count * sizeof(tCell);
+		for(size_t Byte = 0; Byte < Bytes; Byte += 4){
+			__AccessModel.Record(reinterpret_cast<const uint8_t *>(pDest) + Byte, std::min<size_t>(4, Bytes - Byte));
+		}
+		tBase::CopyCells(pDest, pSource, Count);
+	}
+};
+
+// --------------------------------------------------------------------------
+// Accesses of a stereo delay line of 500 ms modulated by 2 ms (Hermite), over
+// one second: per sample or in blocks of BlockSize frames
+template<typename tBase>
+static sAccessModel ModelAccesses(size_t BlockSize, bool Block) {
+	using tLine = DadDSP::cBlockDelayLine<DadDSP::cHermiteInterpolator, cCountedStorage<tBase>>;
+	const uint32_t Capacity = tLine::getCapacity(48000);
+	const size_t Cells = tLine::getCells(Capacity);
+	std::vector<typename tLine::tCell> Memory(2 * Cells, 0);
+	tLine Line[2];
+	Line[0].Initialize(&Memory[0], Capacity);
+	Line[1].Initialize(&Memory[Cells], Capacity);
+	__AccessModel = sAccessModel();
+	__AccessModel.Begin = reinterpret_cast<uintptr_t>(Memory.data());
+	__AccessModel.End = reinterpret_cast<uintptr_t>(Memory.data() + Memory.size());
+
+	const float Delay = 0.5f * SAMPLING_RATE;
+	const float Depth = 0.002f * SAMPLING_RATE;
+	float Samples[AUDIO_BUFFER_SIZE_MAX] = {};
+	float Delays[AUDIO_BUFFER_SIZE_MAX];
+	float Wet[AUDIO_BUFFER_SIZE_MAX];
+	const size_t nFrames = static_cast<size_t>(SAMPLING_RATE);
+	for(size_t Pos = 0; Pos < nFrames; Pos += BlockSize){
+		for(size_t Index = 0; Index < BlockSize; Index++){
+			Delays[Index] = Delay - Depth * std::sin(2.0f * static_cast<float>(M_PI) * 0.5f * (Pos + Index) / SAMPLING_RATE);
+		}
+		for(tLine &Channel : Line){
+			if(Block){
+				Channel.Read(Wet, Delays, BlockSize);
+				Channel.Write(Samples, BlockSize);
+			}else{
+				for(size_t Index = 0; Index < BlockSize; Index++){
+					Wet[Index] = Channel.Pull(Delays[Index]);
+					Channel.Push(Samples[Index]);
+				}
+			}
+		}
+	}
+	__AccessModel.Close();
+	return __AccessModel;
+}
+
+// --------------------------------------------------------------------------
+// SDRAM access table of the delay lines
+static void ReportAccesses(size_t BlockSize) {
+	struct sMode {
+		const char	*Name;
+		sAccessModel(*Model)(size_t BlockSize, bool Block);
+	};
+	static const sMode Modes[] = {
+		{"float",	ModelAccesses<DadDSP::cFloatStorage>},
+		{"int16",	ModelAccesses<DadDSP::cInt16Storage>},
+		{"int24",	ModelAccesses<DadDSP::cInt24Storage>},
+	};
+
+	const double nFrames = SAMPLING_RATE;
+	printf("SDRAM accesses per stereo frame, block %zu (modulated 500 ms Hermite delay line)\n", BlockSize);
+	printf("%-8s %-10s %10s %14s %10s %12s\n", "storage", "path", "accesses", "transactions", "singles", "acc/trans");
+	for(const sMode &Mode : Modes){
+		for(int Block = 0; Block < 2; Block++){
+			sAccessModel Model = Mode.Model(BlockSize, Block == 1);
+			printf("%-8s %-10s %10.2f %14.2f %10.2f %12.2f\n", Mode.Name, Block ? "block" : "per sample",
+				   Model.Accesses / nFrames, Model.Transactions / nFrames, Model.Singles / nFrames,
+				   static_cast<double>(Model.Accesses) / std::max<size_t>(Model.Transactions, 1));
+		}
+	}
+}
+
+// --------------------------------------------------------------------------
+// Max error (against double precision) and time per call of a fast math
+// function and of the libm function it replaces, over Count points of
+// [Min, Max] (spaced in log2 when Log2Scale). The error is relative, or
+// absolute where the exact value is below 1 when Relative is false.
+struct sFastMathResult {
+	double	Error;
+	double	LibTime;		// ns per call
+	double	FastTime;
+};
+
+template<typename tExact, typename tLib, typename tFast>
+static sFastMathResult MeasureFastMath(double Min, double Max, bool Log2Scale, bool Relative,
+									   tExact Exact, tLib Lib, tFast Fast) {
+	constexpr size_t Count = 1 << 20;
+	std::vector<float> X(Count);
+	for(size_t Index = 0; Index < Count; Index++){
+		double Position = Min + ((Max - Min) * Index / (Count - 1));
+		X[Index] = static_cast<float>(Log2Scale ? std::exp2(Position) : Position);
+	}
+
+	sFastMathResult Result = {0.0, 0.0, 0.0};
+	for(float x : X){
+		double Reference = Exact(static_cast<double>(x));
+		double Error = std::fabs(static_cast<double>(Fast(x)) - Reference);
+		Error /= std::max(std::fabs(Reference), Relative ? 1e-30 : 1.0);
+		Result.Error = std::max(Result.Error, Error);
+	}
+
+	// Best of several passes over a span which stays in the L1 cache, in
+	// ascending order as the call sites (LFO, envelope) see their arguments
+	constexpr size_t Span = 4096;
+	auto Time = [&X](auto Function) {
+		double Best = 1e30;
+		volatile float Sink = 0.0f;
+		for(int Pass = 0; Pass < 20; Pass++){
+			auto Start = std::chrono::steady_clock::now();
+			float Sum = 0.0f;
+			for(size_t Index = 0; Index < Count; Index++){
+				Sum += Function(X[Index & (Span - 1)]);
+			}
+			auto End = std::chrono::steady_clock::now();
+			Sink = Sink + Sum;
+			Best = std::min(Best, std::chrono::duration<double, std::nano>(End - Start).count() / Count);
+		}
+		return Best;
+	};
+	for(size_t Index = 0; Index < Span; Index++){
+		X[Index] = X[(Index * (Count / Span)) + (Count / (2 * Span))];
+	}
+	Result.LibTime = Time(Lib);
+	Result.FastTime = Time(Fast);
+	return Result;
+}
+
+// --------------------------------------------------------------------------
+// Error and speedup of the FastMath.h functions against libm
+static void ReportFastMath() {
+	printf("max error: rel = relative, abs = absolute below 1 and relative above\n");
+	printf("%-12s %-18s %-6s %10s %10s %10s %8s\n", "function", "domain", "error", "max", "libm ns", "fast ns", "speedup");
+	auto Report = [](const char *Name, const char *Domain, bool Relative, const sFastMathResult &Result) {
+		printf("%-12s %-18s %-6s %10.2e %10.2f %10.2f %7.2fx\n", Name, Domain, Relative ? "rel" : "abs",
+			   Result.Error, Result.LibTime, Result.FastTime, Result.LibTime / Result.FastTime);
+	};
+	using namespace DadDSP;
+	Report("FastExp2", "[-126, 127]", true, MeasureFastMath(-126.0, 127.0, false, true,
+		[](double x) { return std::exp2(x); }, [](float x) { return exp2f(x); }, [](float x) { return FastExp2(x); }));
+	Report("FastLog2", "[2^-126, 2^127]", false, MeasureFastMath(-126.0, 127.0, true, false,
+		[](double x) { return std::log2(x); }, [](float x) { return log2f(x); }, [](float x) { return FastLog2(x); }));
+	Report("FastExp", "[-87, 88]", true, MeasureFastMath(-87.0, 88.0, false, true,
+		[](double x) { return std::exp(x); }, [](float x) { return expf(x); }, [](float x) { return FastExp(x); }));
+	Report("FastLog", "[2^-126, 2^127]", false, MeasureFastMath(-126.0, 127.0, true, false,
+		[](double x) { return std::log(x); }, [](float x) { return logf(x); }, [](float x) { return FastLog(x); }));
+	Report("FastPow10", "[-37, 38]", true, MeasureFastMath(-37.0, 38.0, false, true,
+		[](double x) { return std::pow(10.0, x); }, [](float x) { return std::pow(10, x); }, [](float x) { return FastPow10(x); }));
+	Report("FastPow10", "[-6, 2]", true, MeasureFastMath(-6.0, 2.0, false, true,
+		[](double x) { return std::pow(10.0, x); }, [](float x) { return std::pow(10, x); }, [](float x) { return FastPow10(x); }));
+	Report("FastLog10", "[2^-126, 2^127]", false, MeasureFastMath(-126.0, 127.0, true, false,
+		[](double x) { return std::log10(x); }, [](float x) { return log10f(x); }, [](float x) { return FastLog10(x); }));
+	Report("FastSin", "[-8192, 8192]", false, MeasureFastMath(-8192.0, 8192.0, false, false,
+		[](double x) { return std::sin(x); }, [](float x) { return sinf(x); }, [](float x) { return FastSin(x); }));
+	Report("FastSin", "[-pi, pi]", false, MeasureFastMath(-M_PI, M_PI, false, false,
+		[](double x) { return std::sin(x); }, [](float x) { return sinf(x); }, [](float x) { return FastSin(x); }));
+	Report("FastCos", "[-8192, 8192]", false, MeasureFastMath(-8192.0, 8192.0, false, false,
+		[](double x) { return std::cos(x); }, [](float x) { return cosf(x); }, [](float x) { return FastCos(x); }));
+	Report("FastTan", "[-1.5, 1.5]", true, MeasureFastMath(-1.5, 1.5, false, true,
+		[](double x) { return std::tan(x); }, [](float x) { return tanf(x); }, [](float x) { return FastTan(x); }));
+	Report("FastTanh", "[-20, 20]", false, MeasureFastMath(-20.0, 20.0, false, false,
+		[](double x) { return std::tanh(x); }, [](float x) { return tanhf(x); }, [](float x) { return FastTanh(x); }));
+	Report("FastSinh", "[-87, 87]", true, MeasureFastMath(-87.0, 87.0, false, true,
+		[](double x) { return std::sinh(x); }, [](float x) { return sinhf(x); }, [](float x) { return FastSinh(x); }));
+	Report("DbToLinear", "[-740, 760] dB", true, MeasureFastMath(-740.0, 760.0, false, true,
+		[](double x) { return std::pow(10.0, x / 20.0); }, [](float x) { return powf(10.0f, x / 20.0f); },
+		[](float x) { return DbToLinear(x); }));
+	Report("DbToLinear", "[-120, 20] dB", true, MeasureFastMath(-120.0, 20.0, false, true,
+		[](double x) { return std::pow(10.0, x / 20.0); }, [](float x) { return powf(10.0f, x / 20.0f); },
+		[](float x) { return DbToLinear(x); }));
+	Report("LinearToDb", "[2^-126, 2^127]", false, MeasureFastMath(-126.0, 127.0, true, false,
+		[](double x) { return 20.0 * std::log10(x); }, [](float x) { return 20.0f * log10f(x); },
+		[](float x) { return LinearToDb(x); }));
+}
+
+// --------------------------------------------------------------------------
+// SAI sample conversion: the AudioConvert.h kernels against the functions
+// they replaced, over all 2^24 codes, the half codes between them and edge
+// floats. Returns the number of mismatches.
+
+// Previous int32ToFloat (sign test)
+static float int32ToFloatRef(int32_t sample) {
+	if(sample & 0x00800000){
+		sample |= 0xFF000000;
+	}else{
+		sample &= 0x00FFFFFF;
+	}
+	return static_cast<float>(sample) / 8388608.0f;
+}
+
+// Previous floatToInt32 (clamp to [-1.0, 1.0], then mask)
+static int32_t floatToInt32Ref(float sample) {
+	if(sample > 1.0f) sample = 1.0f;
+	if(sample < -1.0f) sample = -1.0f;
+	int32_t intSample = static_cast<int32_t>(sample * 8388608.0f);
+	return intSample & 0xFFFFFF;
+}
+
+static int ReportConversion(size_t BlockSize) {
+	constexpr size_t nCodes = 1 << 24;
+	constexpr size_t nFrames = nCodes / 2;
+	BlockSize += BlockSize & 1;					// The kernels convert frame pairs
+
+	// All codes, the upper byte filled with noise (ignored by both versions)
+	std::vector<int32_t> Codes(nCodes);
+	uint32_t Random = 1;
+	for(size_t Code = 0; Code < nCodes; Code++){
+		Random = Random * 1664525 + 1013904223;
+		Codes[Code] = static_cast<int32_t>((Random & 0xFF000000) | Code);
+	}
+	std::vector<float> RefLeft(nFrames), RefRight(nFrames), Left(nFrames), Right(nFrames);
+	std::vector<int32_t> RefInts(nCodes), Ints(nCodes);
+
+	// Converts every code block by block as in the SAI callbacks, then returns
+	// the best time of 5 passes in ns per sample over a span which stays in the
+	// L1 cache (the DMA buffers are in DTCM / non cached RAM on the pedal)
+	auto Time = [&](auto Block) {
+		for(size_t Pos = 0; Pos < nFrames; Pos += BlockSize){
+			Block(Pos, std::min(BlockSize, nFrames - Pos));
+		}
+		const size_t Span = (2048 / BlockSize) * BlockSize;
+		double Best = 1e30;
+		for(int Pass = 0; Pass < 5; Pass++){
+			auto Start = std::chrono::steady_clock::now();
+			for(size_t Pos = 0; Pos < nFrames; Pos += BlockSize){
+				Block(Pos % Span, BlockSize);
+			}
+			auto End = std::chrono::steady_clock::now();
+			Best = std::min(Best, std::chrono::duration<double, std::nano>(End - Start).count() / nCodes);
+		}
+		return Best;
+	};
+	auto Report = [](const char *Name, double RefTime, double Time, size_t Mismatches) {
+		printf("%-22s %10.3f %10.3f %7.2fx %10zu  %s\n", Name, RefTime, Time, RefTime / Time, Mismatches,
+			   (Mismatches == 0) ? "pass" : "FAIL");
+	};
+
+	printf("int24 <-> float, %zu codes, block %zu\n", nCodes, BlockSize);
+	printf("%-22s %10s %10s %8s %10s\n", "conversion", "ref ns/smp", "ns/smp", "speedup", "mismatches");
+	int Failed = 0;
+
+	// int24 -> float: bit-exact
+	double RefTime = Time([&](size_t Pos, size_t Size) {
+		for(size_t Index = Pos; Index < Pos + Size; Index++){
+			RefLeft[Index] = int32ToFloatRef(Codes[Index * 2]);
+			RefRight[Index] = int32ToFloatRef(Codes[Index * 2 + 1]);
+		}
+	});
+	double NewTime = Time([&](size_t Pos, size_t Size) {
+		ConvertToPlanar(&Codes[Pos * 2], &Left[Pos], &Right[Pos], Size);
+	});
+	size_t Mismatches = 0;
+	for(size_t Index = 0; Index < nFrames; Index++){
+		Mismatches += (Left[Index] != RefLeft[Index]) || (Right[Index] != RefRight[Index]);
+	}
+	Report("int24 -> float", RefTime, NewTime, Mismatches);
+	Failed += (Mismatches != 0);
+
+	// float -> int24: identical, and every code comes back
+	for(int Half = 0; Half < 2; Half++){
+		if(Half){
+			// Half codes: truncation toward zero must match as well
+			for(size_t Index = 0; Index < nFrames; Index++){
+				Left[Index] = Left[Index] + ((Left[Index] < 0.0f) ? -0.5f : 0.5f) * kInvInt24Scale;
+				Right[Index] = Right[Index] + ((Right[Index] < 0.0f) ? -0.5f : 0.5f) * kInvInt24Scale;
+			}
+		}
+		RefTime = Time([&](size_t Pos, size_t Size) {
+			for(size_t Index = Pos; Index < Pos + Size; Index++){
+				RefInts[Index * 2] = floatToInt32Ref(Left[Index]);
+				RefInts[Index * 2 + 1] = floatToInt32Ref(Right[Index]);
+			}
+		});
+		NewTime = Time([&](size_t Pos, size_t Size) {
+			ConvertFromPlanar(&Left[Pos], &Right[Pos], &Ints[Pos * 2], Size);
+		});
+		Mismatches = 0;
+		for(size_t Code = 0; Code < nCodes; Code++){
+			bool RoundTrip = Half || (Ints[Code] == (Codes[Code] & 0xFFFFFF));
+			Mismatches += (Ints[Code] != RefInts[Code]) || !RoundTrip;
+		}
+		Report(Half ? "float -> int24 (half)" : "float -> int24", RefTime, NewTime, Mismatches);
+		Failed += (Mismatches != 0);
+	}
+
+	// Edge floats. At and above +1.0 the previous clamp gave 0x800000 (negative
+	// full scale for the codec): the kernel saturates to 0x7FFFFF instead.
+	// NaN was an undefined conversion (not run): the kernel gives -1.0.
+	struct sEdge {
+		float	Value;
+		int32_t	Expected;
+		bool	SameAsRef;
+	};
+	const float Inf = std::numeric_limits<float>::infinity();
+	const sEdge Edges[] = {
+		{-1.0f, 0x800000, true}, {-1.5f, 0x800000, true}, {-Inf, 0x800000, true},
+		{8388607.0f / 8388608.0f, 0x7FFFFF, true}, {std::nextafter(1.0f, 0.0f), 0x7FFFFF, true},
+		{1.0f, 0x7FFFFF, false}, {1.5f, 0x7FFFFF, false}, {Inf, 0x7FFFFF, false},
+		{-0.0f, 0, true}, {std::numeric_limits<float>::denorm_min(), 0, true},
+		{std::numeric_limits<float>::quiet_NaN(), 0x800000, false},
+	};
+	printf("\n%-14s %10s %10s %10s\n", "edge float", "ref", "kernel", "expected");
+	for(const sEdge &Edge : Edges){
+		int32_t Value = floatToInt32(Edge.Value);
+		bool Pass = (Value == Edge.Expected);
+		if(std::isnan(Edge.Value)){
+			printf("%-14g %10s", Edge.Value, "undefined");
+		}else{
+			int32_t Ref = floatToInt32Ref(Edge.Value);
+			Pass = Pass && ((Ref == Value) == Edge.SameAsRef);
+			printf("%-14.9g 0x%08X", Edge.Value, static_cast<unsigned>(Ref));
+		}
+		printf(" 0x%08X 0x%08X  %s\n", static_cast<unsigned>(Value), static_cast<unsigned>(Edge.Expected),
+			   Pass ? "pass" : "FAIL");
+		Failed += Pass ? 0 : 1;
+	}
+	return Failed;
+}
+
+// --------------------------------------------------------------------------
+// Per-callback overhead at each block size: the audio callback sequence of
+// the pedal (SAI words to planar, RTProcess of the GUI objects, effect,
+// planar to SAI words) with and without the effect Process. The overhead
+// is the part which does not depend on the effect; ISR entry and the
+// monitor are not modelled.
+class cCallbackRenderer : public DadHost::cRenderer {
+public:
+	// Best time of 3 runs over Rx (interleaved SAI words), in seconds
+	double Run(const std::vector<int32_t> &Rx, std::vector<int32_t> &Tx, bool Effect) {
+		const size_t nFrames = Rx.size() / 2;
+		double Best = 1e30;
+		for(int Pass = 0; Pass < 3; Pass++){
+			auto Start = std::chrono::steady_clock::now();
+			for(size_t Pos = 0; Pos + AUDIO_BUFFER_SIZE <= nFrames; Pos += AUDIO_BUFFER_SIZE){
+				ConvertToPlanar(&Rx[Pos * 2], m_In.Left, m_In.Right, AUDIO_BUFFER_SIZE);
+				for(DadUI::iGUIObject *pObject : m_Objects){
+					pObject->RTProcess();
+				}
+				if(Effect){
+					m_pEffect->Process(m_In.getBlock(AUDIO_BUFFER_SIZE), m_Out.getBlock(AUDIO_BUFFER_SIZE));
+				}
+				ConvertFromPlanar(m_Out.Left, m_Out.Right, &Tx[Pos * 2], AUDIO_BUFFER_SIZE);
+			}
+			auto End = std::chrono::steady_clock::now();
+			Best = std::min(Best, std::chrono::duration<double>(End - Start).count());
+		}
+		return Best;
+	}
+};
+
+static void ReportBlockSizes(float Duration) {
+	DadHost::cWavFile Noise;
+	DadHost::MakeNoise(Noise, Duration);
+	const size_t nFrames = (Noise.getSize() / AUDIO_BUFFER_SIZE_MAX) * AUDIO_BUFFER_SIZE_MAX;
+	std::vector<int32_t> Rx(nFrames * 2), Tx(nFrames * 2);
+	ConvertFromPlanar(Noise.m_Left.data(), Noise.m_Right.data(), Rx.data(), nFrames);
+
+	const uint32_t PlatformSize = __AudioBufferSize;
+	size_t nEffects;
+	const DadHost::sHostEffect *pEffects = DadHost::getEffects(nEffects);
+	printf("%.1f s of noise, ns per stereo frame\n", Duration);
+	printf("%-14s %6s %12s %12s %12s %12s %10s\n", "effect", "block", "latency us", "overhead", "effect", "total", "overhead %");
+	for(size_t Effect = 0; Effect < nEffects; Effect++){
+		for(uint32_t BlockSize = AUDIO_BUFFER_SIZE_MIN; BlockSize <= AUDIO_BUFFER_SIZE_MAX; BlockSize *= 2){
+			// The effect is created at the block size, as at boot
+			__AudioBufferSize = BlockSize;
+			cCallbackRenderer Renderer;
+			Renderer.Init(pEffects[Effect]);
+			Renderer.Settle(5.0f);
+			const double Overhead = 1e9 * Renderer.Run(Rx, Tx, false) / nFrames;
+			const double Total = 1e9 * Renderer.Run(Rx, Tx, true) / nFrames;
+			printf("%-14s %6u %12.1f %12.2f %12.2f %12.2f %9.1f%%\n", pEffects[Effect].Name, BlockSize,
+				   1e6 * BlockSize / SAMPLING_RATE, Overhead, Total - Overhead, Total, 100.0 * Overhead / Total);
+		}
+	}
+	__AudioBufferSize = PlatformSize;
+}
+
+// --------------------------------------------------------------------------
+// Command line help
+static void Usage() {
+	fprintf(stderr,
+		"usage: penda_bench [options] [case ...]\n"
+		"  -n <frames>        block size (default %u)\n"
+		"  -t <dBFS>          peak difference floor (default -80)\n"
+		"  -d <seconds>       length of the noise signal (default 2)\n"
+		"  -g <GHz>           host clock for the cycle counts (default: time stamp counter)\n"
+		"  -q                 quality tables of the delay line interpolators and storages, and of cDCO\n"
+		"  -m                 SDRAM access model of the delay lines (block size -n)\n"
+		"  -f                 error and speedup of the fast math functions against libm\n"
+		"  -b                 per-callback overhead of each effect at block sizes 4 to 64 (length -d)\n"
+		"  -c                 int24 <-> float conversion kernels against the previous functions (block size -n)\n"
+		"cases:", AUDIO_BUFFER_SIZE_DEFAULT);
+	for(const sBenchCase &Case : __BenchCases){
+		fprintf(stderr, " %s", Case.Name);
+	}
+	fprintf(stderr, "\n");
+}
+
+// --------------------------------------------------------------------------
+// Entry point
+int main(int argc, char *argv[]) {
+	size_t BlockSize = AUDIO_BUFFER_SIZE_DEFAULT;
+	double Floor = -80.0;
+	float Duration = 2.0f;
+	double Clock = 0.0;
+	std::vector<std::string> Names;
+	bool AccessModel = false;
+	bool Conversion = false;
+	bool BlockSizes = false;
+
+	for(int Arg = 1; Arg < argc; Arg++){
+		std::string Option = argv[Arg];
+		bool HasValue = (Arg + 1 < argc);
+		if((Option == "-n") && HasValue){
+			BlockSize = static_cast<size_t>(atoi(argv[++Arg]));
+		}else if((Option == "-t") && HasValue){
+			Floor = atof(argv[++Arg]);
+		}else if((Option == "-d") && HasValue){
+			Duration = static_cast<float>(atof(argv[++Arg]));
+		}else if((Option == "-g") && HasValue){
+			Clock = atof(argv[++Arg]);
+		}else if(Option == "-q"){
+			ReportInterpolators();
+			printf("\n");
+			ReportStorages();
+			printf("\n");
+			ReportDCO();
+			return 0;
+		}else if(Option == "-m"){
+			AccessModel = true;
+		}else if(Option == "-b"){
+			BlockSizes = true;
+		}else if(Option == "-c"){
+			Conversion = true;
+		}else if(Option == "-f"){
+			ReportFastMath();
+			return 0;
+		}else if(Option[0] != '-'){
+			Names.push_back(Option);
+		}else{
+			Usage();
+			return 1;
+		}
+	}
+	if((BlockSize < 1) || (BlockSize > AUDIO_BUFFER_SIZE_MAX) || (Duration <= 0.0f)){
+		Usage();
+		return 1;
+	}
+	if(AccessModel){
+		ReportAccesses(BlockSize);
+		return 0;
+	}
+	if(Conversion){
+		return (ReportConversion(BlockSize) == 0) ? 0 : 1;
+	}
+
+	DadHost::Init(static_cast<uint32_t>(BlockSize));
+	if(BlockSizes){
+		ReportBlockSizes(Duration);
+		return 0;
+	}
+
+	DadHost::cWavFile In, RefOut, Out;
+	DadHost::MakeNoise(In, Duration);
+	RefOut.Create(In.getSize(), In.getSampleRate());
+	Out.Create(In.getSize(), In.getSampleRate());
+	const double nFrames = static_cast<double>(In.getSize());
+
+	if(Clock <= 0.0){
+		Clock = CyclesPerNs();
+	}
+
+	printf("block %zu, %.1f s of noise, %.2f GHz\n", BlockSize, Duration, Clock);
+	printf("%-18s %-20s %10s %10s %8s %8s %12s\n", "case", "kernel", "ref ns/fr", "ns/fr", "cyc/fr", "speedup", "peak diff");
+	int Failed = 0;
+	int Count = 0;
+	for(const sBenchCase &Case : __BenchCases){
+		if(!Names.empty() && (std::find(Names.begin(), Names.end(), Case.Name) == Names.end())){
+			continue;
+		}
+		double RefTime = TimeRun(Case.Run, In, RefOut, BlockSize, true);
+		double Time = TimeRun(Case.Run, In, Out, BlockSize, false);
+		double Difference = PeakDifference(RefOut, Out);
+		double Cycles = Clock * 1e9 * Time / nFrames;
+		bool Pass = !Case.Checked || (Difference <= Floor);
+		bool InBudget = (Case.CycleBudget == 0.0f) || (Clock == 0.0) || (Cycles <= Case.CycleBudget);
+		Pass = Pass && InBudget;
+
+		printf("%-18s %-20s %10.2f %10.2f %8.1f %7.2fx %7.1f dBFS  %s (vs %s)", Case.Name, Case.Kernel,
+			   1e9 * RefTime / nFrames, 1e9 * Time / nFrames, Cycles, RefTime / Time, Difference,
+			   Case.Checked ? (Pass ? "pass" : "FAIL") : "info", Case.ReferencePath);
+		if(Case.CycleBudget != 0.0f){
+			printf(", budget %.0f cyc/fr%s", Case.CycleBudget, InBudget ? "" : " exceeded");
+		}
+		printf("\n");
+		Failed += Pass ? 0 : 1;
+		Count++;
+	}
+	printf("%d case(s), %d failed\n", Count, Failed);
+	return (Failed == 0) ? 0 : 1;
+}
@@ -0,0 +1,327 @@
+//====================================================================================
+// PendaRegress.cpp
+//
+// Host build: golden output regression of the effects and DSP primitives.
+//
+//   penda_regress record <reference dir> [-i take.wav]...
+//   penda_regress check  <reference dir> [-t <floor dBFS>] [-i take.wav]...
+//
+// Every case renders a fixed input (impulse, sweep, noise, plucks or a DI take
+// given with -i) through an effect or a DSP primitive, with fixed parameter
+// automation. "record" stores the outputs as float WAV files, "check" renders
+// again and compares with them: a case fails when the peak of the difference
+// is above the error floor (default -90 dBFS).
+//
+// Copyright(c) 2025 Dad Design.
+//====================================================================================
+#include "cRenderer.h"
+#include "TestSignals.h"
+#include "EffectInterface.h"
+#include "BiquadFilter.h"
+#include "cDelayLine.h"
+#include "cDCO.h"
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+//***********************************************************************************
+// DSP primitives seen as effects
+//***********************************************************************************
+
+// --------------------------------------------------------------------------
+// cBiQuad, fixed or with a cutoff modulated every block
+template<DadDSP::FilterType tType, int tCutoff, int tGainDb, bool tModulated>
+class cBiQuadCase : public DadHost::iHostEffect {
+public:
+	cBiQuadCase() {
+		m_Filter.Initialize(SAMPLING_RATE, tCutoff, tGainDb, 1.0f, tType);
+	}
+
+	void Process(const AudioBlock &In, const AudioBlock &Out) override {
+		if(tModulated){
+			// One cycle every 2 s between Cutoff / 4 and Cutoff * 4
+			m_Phase += In.Size / (2.0f * SAMPLING_RATE);
+			m_Filter.setCutoffFreq(tCutoff * exp2f(2.0f * sinf(6.2831853f * m_Phase)));
+			m_Filter.CalculateParameters();
+		}
+		for(size_t Index = 0; Index < In.Size; Index++){
+			Out.L(Index) = m_Filter.Process(In.L(Index), DadDSP::eChannel::Left);
+			Out.R(Index) = m_Filter.Process(In.R(Index), DadDSP::eChannel::Right);
+		}
+	}
+
+protected:
+	DadDSP::cBiQuad	m_Filter;
+	float			m_Phase = 0.0f;
+};
+
+// --------------------------------------------------------------------------
+// cDelayLine: modulated fractional read (left), fixed integer read (right)
+class cDelayLineCase : public DadHost::iHostEffect {
+public:
+	static constexpr uint32_t kSize = 48000;
+
+	cDelayLineCase() {
+		m_Left.Initialize(__EffectArena.AllocateArray<float>(kSize + 100), kSize);
+		m_Left.Clear();
+		m_Right.Initialize(__EffectArena.AllocateArray<float>(kSize + 100), kSize);
+		m_Right.Clear();
+		m_LFO.Initialize(SAMPLING_RATE, 0.0f, 0.7f, 0.7f, 0.5f);
+	}
+
+	void Process(const AudioBlock &In, const AudioBlock &Out) override {
+		for(size_t Index = 0; Index < In.Size; Index++){
+			m_LFO.Step();
+			m_Left.Push(In.L(Index));
+			m_Right.Push(In.R(Index));
+			Out.L(Index) = In.L(Index) + m_Left.Pull(4800.0f + 2400.0f * m_LFO.getTriangleValue());
+			Out.R(Index) = In.R(Index) + m_Right.Pull(static_cast<int32_t>(7200));
+		}
+	}
+
+protected:
+	DadDSP::cDelayLine	m_Left;
+	DadDSP::cDelayLine	m_Right;
+	DadDSP::cDCO		m_LFO;
+};
+
+// --------------------------------------------------------------------------
+// cDCO: waveforms of a swept oscillator (input ignored)
+class cDCOCase : public DadHost::iHostEffect {
+public:
+	cDCOCase() {
+		m_DCO.Initialize(SAMPLING_RATE, 0.0f, 0.5f, 20.0f, 0.3f);
+	}
+
+	void Process(const AudioBlock &In, const AudioBlock &Out) override {
+		for(size_t Index = 0; Index < In.Size; Index++){
+			m_DCO.setNormalizedFreq(m_Sweep);
+			m_Sweep = (m_Sweep < 1.0f) ? m_Sweep + 1.0f / (4.0f * SAMPLING_RATE) : 0.0f;
+			m_DCO.Step();
+			Out.L(Index) = m_DCO.getSineValue() - 0.5f;
+			Out.R(Index) = 0.25f * (m_DCO.getSquareModValue() + m_DCO.getTriangleValuePhased(0.25f)
+			                      + m_DCO.getTriangleModValue() + m_DCO.getRectifiedSineValue()) - 0.5f;
+		}
+	}
+
+protected:
+	DadDSP::cDCO	m_DCO;
+	float			m_Sweep = 0.0f;
+};
+
+template<typename T>
+static DadHost::iHostEffect *CreateCase() {
+	return new T;
+}
+
+static const DadHost::sHostEffect __Primitives[] = {
+	{"biquad-lpf",		0, CreateCase<cBiQuadCase<DadDSP::FilterType::LPF, 1000, 0, false>>},
+	{"biquad-hpf24",	0, CreateCase<cBiQuadCase<DadDSP::FilterType::HPF24, 200, 0, false>>},
+	{"biquad-peq",		0, CreateCase<cBiQuadCase<DadDSP::FilterType::PEQ, 800, 9, false>>},
+	{"biquad-hsh",		0, CreateCase<cBiQuadCase<DadDSP::FilterType::HSH, 3000, -6, false>>},
+	{"biquad-mod",		0, CreateCase<cBiQuadCase<DadDSP::FilterType::LPF24, 1000, 0, true>>},
+	{"delayline",		0, CreateCase<cDelayLineCase>},
+	{"dco",				0, CreateCase<cDCOCase>},
+};
+
+//***********************************************************************************
+// Corpus
+//***********************************************************************************
+enum class eInput {
+	Impulse,
+	Sweep,
+	Noise,
+	Plucks,
+	File
+};
+
+struct sCase {
+	std::string						Name;
+	std::string						Effect;
+	eInput							Input;
+	float							Duration;
+	std::vector<DadHost::sAutomation>	Automation;
+	std::string						InputPath;			// eInput::File
+};
+
+// Preset value indexes (serialization order, see penda_render --dump-preset)
+//   delay   : 0 Time, 1 Repeat, 2 Mix, 3 Sub, 4 Repeat 2, 5 Blend, 6 Bass, 7 Treble, 8 Mod. depth, 9 Mod. speed,
+//             10 Tap pattern, 11 Tap spread
+//   tremolo : 0 Depth, 1 Vibrato, 2 Mix, 3 Shape, 4 Speed, 5 Ratio, 6 Stereo
+//   eq      : 0 Low cut, 1-2 Low shelf freq/gain, 3-5 Mid freqs, 6-8 Mid gains, 9-11 Mid widths,
+//             12-13 High shelf freq/gain, 14 High cut
+static std::vector<sCase> BuildCorpus(const std::vector<std::string> &Takes) {
+	std::vector<sCase> Corpus = {
+		{"delay-impulse",		"delay",	eInput::Impulse,	3.0f, {}, ""},
+		{"delay-plucks",		"delay",	eInput::Plucks,		4.0f, {{1.0f, 0, 0.3f}, {2.0f, 1, 60.0f}, {2.5f, 5, 50.0f}, {3.0f, 8, 60.0f}}, ""},
+		{"delay-sweep",			"delay",	eInput::Sweep,		3.0f, {{1.5f, 6, 80.0f}, {1.5f, 7, 20.0f}}, ""},
+		{"delay-taps-plucks",	"delay",	eInput::Plucks,		4.0f, {{0.0f, 10, 2.0f}, {0.0f, 5, 70.0f}, {0.0f, 0, 0.8f}, {2.0f, 10, 4.0f}, {2.0f, 11, 100.0f}}, ""},
+		{"tremolo-plucks",		"tremolo",	eInput::Plucks,		3.0f, {{1.0f, 4, 9.0f}, {2.0f, 0, 90.0f}}, ""},
+		{"tremolo-noise",		"tremolo",	eInput::Noise,		2.0f, {{1.0f, 5, 20.0f}}, ""},
+		{"tremolo-stereo-plucks","tremolo",	eInput::Plucks,		3.0f, {{0.0f, 6, 1.0f}, {0.0f, 5, 30.0f}, {1.0f, 0, 100.0f}, {2.0f, 0, 10.0f}}, ""},
+		{"tremolo-square-noise","tremolo",	eInput::Noise,		3.0f, {{0.0f, 3, 1.0f}, {0.0f, 6, 3.0f}, {0.0f, 1, 50.0f}, {1.0f, 0, 80.0f}, {2.0f, 6, 2.0f}}, ""},
+		{"tremolo-delay-plucks","tremolo-delay",	eInput::Plucks,		3.0f, {}, ""},
+		{"eq-sweep",			"eq",		eInput::Sweep,		3.0f, {{0.1f, 2, 6.0f}, {0.1f, 6, -6.0f}, {0.1f, 7, 9.0f}, {0.1f, 13, -9.0f}, {1.5f, 0, 200.0f}, {1.5f, 14, 6000.0f}}, ""},
+		{"biquad-lpf-noise",	"biquad-lpf",	eInput::Noise,		1.0f, {}, ""},
+		{"biquad-hpf24-sweep",	"biquad-hpf24",	eInput::Sweep,		2.0f, {}, ""},
+		{"biquad-peq-sweep",	"biquad-peq",	eInput::Sweep,		2.0f, {}, ""},
+		{"biquad-hsh-noise",	"biquad-hsh",	eInput::Noise,		1.0f, {}, ""},
+		{"biquad-mod-noise",	"biquad-mod",	eInput::Noise,		4.0f, {}, ""},
+		{"delayline-plucks",	"delayline",	eInput::Plucks,		3.0f, {}, ""},
+		{"dco",					"dco",			eInput::Impulse,	4.0f, {}, ""},
+	};
+
+	// DI takes through every effect
+	for(const std::string &Take : Takes){
+		std::string Stem = Take.substr(Take.find_last_of('/') + 1);
+		Stem = Stem.substr(0, Stem.find_last_of('.'));
+		for(const char *Effect : {"delay", "tremolo", "tremolo-delay", "eq"}){
+			Corpus.push_back({std::string(Effect) + "-" + Stem, Effect, eInput::File, 0.0f, {}, Take});
+		}
+	}
+	return Corpus;
+}
+
+// --------------------------------------------------------------------------
+// Renders one case
+static bool RenderCase(const sCase &Case, DadHost::cWavFile &Out) {
+	DadHost::cWavFile In;
+	switch(Case.Input){
+	case eInput::Impulse:	DadHost::MakeImpulse(In, Case.Duration); break;
+	case eInput::Sweep:		DadHost::MakeSweep(In, Case.Duration, 20.0f, 20000.0f); break;
+	case eInput::Noise:		DadHost::MakeNoise(In, Case.Duration); break;
+	case eInput::Plucks:	DadHost::MakePlucks(In, Case.Duration, 110.0f, 0.75f); break;
+	case eInput::File:
+		if(!In.Load(Case.InputPath)){
+			fprintf(stderr, "penda_regress: %s\n", In.getError().c_str());
+			return false;
+		}
+		break;
+	}
+
+	const DadHost::sHostEffect *pEffect = DadHost::FindEffect(Case.Effect);
+	for(const DadHost::sHostEffect &Primitive : __Primitives){
+		if(Case.Effect == Primitive.Name){
+			pEffect = &Primitive;
+		}
+	}
+	if(pEffect == nullptr){
+		return false;
+	}
+
+	DadHost::cRenderer Renderer;
+	Renderer.Init(*pEffect);
+	Renderer.Settle(30.0f);
+	Renderer.Render(In, Out, Case.Automation);
+	return true;
+}
+
+// --------------------------------------------------------------------------
+// Level in dBFS (floor at -200 dB)
+static float ToDb(double Value) {
+	return (Value > 1e-10) ? static_cast<float>(20.0 * log10(Value)) : -200.0f;
+}
+
+// --------------------------------------------------------------------------
+// Command line help
+static void Usage() {
+	fprintf(stderr,
+		"usage: penda_regress record <reference dir> [options]\n"
+		"       penda_regress check  <reference dir> [options]\n"
+		"  -t <dBFS>      error floor of check (default -90)\n"
+		"  -n <frames>    audio block size (default %u, must match the references)\n"
+		"  -i <take.wav>  adds a DI take rendered through every effect (repeatable)\n",
+		AUDIO_BUFFER_SIZE_DEFAULT);
+}
+
+// --------------------------------------------------------------------------
+// Entry point
+int main(int argc, char *argv[]) {
+	if(argc < 3){
+		Usage();
+		return 1;
+	}
+	const std::string Mode = argv[1];
+	const std::string RefDir = argv[2];
+	float Floor = -90.0f;
+	uint32_t BlockSize = AUDIO_BUFFER_SIZE_DEFAULT;
+	std::vector<std::string> Takes;
+
+	for(int Arg = 3; Arg < argc; Arg++){
+		std::string Option = argv[Arg];
+		bool HasValue = (Arg + 1 < argc);
+		if((Option == "-t") && HasValue){
+			Floor = static_cast<float>(atof(argv[++Arg]));
+		}else if((Option == "-n") && HasValue){
+			BlockSize = static_cast<uint32_t>(atoi(argv[++Arg]));
+		}else if((Option == "-i") && HasValue){
+			Takes.push_back(argv[++Arg]);
+		}else{
+			Usage();
+			return 1;
+		}
+	}
+	if(((Mode != "record") && (Mode != "check")) ||
+	   (BlockSize < AUDIO_BUFFER_SIZE_MIN) || (BlockSize > AUDIO_BUFFER_SIZE_MAX) || (BlockSize & (BlockSize - 1))){
+		Usage();
+		return 1;
+	}
+
+	DadHost::Init(BlockSize);
+
+	uint32_t nFailed = 0;
+	std::vector<sCase> Corpus = BuildCorpus(Takes);
+	for(const sCase &Case : Corpus){
+		const std::string RefPath = RefDir + "/" + Case.Name + ".wav";
+		DadHost::cWavFile Out;
+		if(!RenderCase(Case, Out)){
+			printf("%-24s ERROR (render)\n", Case.Name.c_str());
+			nFailed++;
+			continue;
+		}
+
+		if(Mode == "record"){
+			if(!Out.Save(RefPath, DadHost::cWavFile::eFormat::Float32)){
+				printf("%-24s ERROR (cannot write %s)\n", Case.Name.c_str(), RefPath.c_str());
+				nFailed++;
+			}else{
+				printf("%-24s recorded\n", Case.Name.c_str());
+			}
+			continue;
+		}
+
+		DadHost::cWavFile Ref;
+		if(!Ref.Load(RefPath) || (Ref.getSize() != Out.getSize())){
+			printf("%-24s ERROR (missing or different reference %s)\n", Case.Name.c_str(), RefPath.c_str());
+			nFailed++;
+			continue;
+		}
+
+		// Difference signal
+		double PeakError = 0.0, SumError = 0.0, PeakRef = 0.0;
+		for(size_t Index = 0; Index < Out.getSize(); Index++){
+			double ErrorL = std::fabs(static_cast<double>(Out.m_Left[Index]) - Ref.m_Left[Index]);
+			double ErrorR = std::fabs(static_cast<double>(Out.m_Right[Index]) - Ref.m_Right[Index]);
+			if(!std::isfinite(Out.m_Left[Index]) || !std::isfinite(Out.m_Right[Index])){
+				ErrorL = ErrorR = 1.0;
+			}
+			PeakError = std::max(PeakError, std::max(ErrorL, ErrorR));
+			SumError += ErrorL * ErrorL + ErrorR * ErrorR;
+			PeakRef = std::max(PeakRef, static_cast<double>(std::max(std::fabs(Ref.m_Left[Index]), std::fabs(Ref.m_Right[Index]))));
+		}
+		float PeakDb = ToDb(PeakError);
+		float RmsDb = ToDb(std::sqrt(SumError / (2.0 * Out.getSize())));
+		bool Pass = PeakDb <= Floor;
+		printf("%-24s %s  peak error %7.1f dBFS  rms error %7.1f dBFS  (reference peak %6.1f dBFS)\n",
+			   Case.Name.c_str(), Pass ? "pass" : "FAIL", PeakDb, RmsDb, ToDb(PeakRef));
+		if(!Pass){
+			nFailed++;
+		}
+	}
+
+	printf("%u case(s), %u failed\n", static_cast<unsigned>(Corpus.size()), nFailed);
+	return (nFailed == 0) ? 0 : 1;
+}
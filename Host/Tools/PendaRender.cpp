@@ -0,0 +1,167 @@
+//====================================================================================
+// PendaRender.cpp
+//
+// Host build: renders an effect over a WAV file, faster than real time.
+//
+//   penda_render -e <effect> [options] <input.wav> <output.wav>
+//
+// Copyright(c) 2025 Dad Design.
+//====================================================================================
+#include "cRenderer.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// --------------------------------------------------------------------------
+// Command line help
+static void Usage() {
+	size_t Count;
+	const DadHost::sHostEffect *pEffects = DadHost::getEffects(Count);
+
+	fprintf(stderr,
+		"usage: penda_render -e <effect> [options] <input.wav> <output.wav>\n"
+		"  -e <effect>        effect:");
+	for(size_t Index = 0; Index < Count; Index++){
+		fprintf(stderr, " %s", pEffects[Index].Name);
+	}
+	fprintf(stderr, "\n"
+		"  -p <preset.txt>    text preset (one value per line, serialization order)\n"
+		"  -b <preset.bin>    cSerialize preset blob (as saved by the pedal)\n"
+		"  -s <index>=<value> sets one preset value (repeatable)\n"
+		"  -n <frames>        audio block size: 4, 8, 16, 32 or 64 (default %u)\n"
+		"  -f <format>        output format: pcm16, pcm24 or float (default pcm24)\n"
+		"  --no-settle        starts rendering while parameters still ramp (as at boot)\n"
+		"  --dump-preset <f>  writes the preset used as text\n"
+		"  --dump-blob <f>    writes the preset used as a blob\n",
+		AUDIO_BUFFER_SIZE_DEFAULT);
+}
+
+// --------------------------------------------------------------------------
+// Entry point
+int main(int argc, char *argv[]) {
+	std::string EffectName, TextPreset, BlobPreset, DumpPreset, DumpBlob, InPath, OutPath;
+	std::vector<std::pair<size_t, float>> SetValues;
+	uint32_t BlockSize = AUDIO_BUFFER_SIZE_DEFAULT;
+	DadHost::cWavFile::eFormat Format = DadHost::cWavFile::eFormat::PCM24;
+	bool WithSettle = true;
+
+	// Arguments ----------------------------------------------------------------
+	for(int Arg = 1; Arg < argc; Arg++){
+		std::string Option = argv[Arg];
+		bool HasValue = (Arg + 1 < argc);
+		if((Option == "-e") && HasValue){
+			EffectName = argv[++Arg];
+		}else if((Option == "-p") && HasValue){
+			TextPreset = argv[++Arg];
+		}else if((Option == "-b") && HasValue){
+			BlobPreset = argv[++Arg];
+		}else if((Option == "-s") && HasValue){
+			unsigned Index;
+			float Value;
+			if(sscanf(argv[++Arg], "%u=%f", &Index, &Value) != 2){
+				Usage();
+				return 1;
+			}
+			SetValues.push_back({Index, Value});
+		}else if((Option == "-n") && HasValue){
+			BlockSize = static_cast<uint32_t>(atoi(argv[++Arg]));
+		}else if((Option == "-f") && HasValue){
+			std::string Name = argv[++Arg];
+			if(Name == "pcm16"){
+				Format = DadHost::cWavFile::eFormat::PCM16;
+			}else if(Name == "float"){
+				Format = DadHost::cWavFile::eFormat::Float32;
+			}else if(Name != "pcm24"){
+				Usage();
+				return 1;
+			}
+		}else if(Option == "--no-settle"){
+			WithSettle = false;
+		}else if((Option == "--dump-preset") && HasValue){
+			DumpPreset = argv[++Arg];
+		}else if((Option == "--dump-blob") && HasValue){
+			DumpBlob = argv[++Arg];
+		}else if(InPath.empty() && (Option[0] != '-')){
+			InPath = Option;
+		}else if(OutPath.empty() && (Option[0] != '-')){
+			OutPath = Option;
+		}else{
+			Usage();
+			return 1;
+		}
+	}
+
+	const DadHost::sHostEffect *pEffect = DadHost::FindEffect(EffectName);
+	if((pEffect == nullptr) || InPath.empty() || OutPath.empty()){
+		Usage();
+		return 1;
+	}
+	if((BlockSize < AUDIO_BUFFER_SIZE_MIN) || (BlockSize > AUDIO_BUFFER_SIZE_MAX) || (BlockSize & (BlockSize - 1))){
+		fprintf(stderr, "penda_render: invalid block size %u\n", BlockSize);
+		return 1;
+	}
+
+	// Input --------------------------------------------------------------------
+	DadHost::cWavFile In;
+	if(!In.Load(InPath)){
+		fprintf(stderr, "penda_render: %s\n", In.getError().c_str());
+		return 1;
+	}
+	if(In.getSampleRate() != static_cast<uint32_t>(SAMPLING_RATE)){
+		fprintf(stderr, "penda_render: warning: %s is %u Hz, the effects run at %u Hz (no resampling)\n",
+				InPath.c_str(), In.getSampleRate(), static_cast<unsigned>(SAMPLING_RATE));
+	}
+
+	// Effect and preset --------------------------------------------------------
+	DadHost::Init(BlockSize);
+	DadHost::cRenderer Renderer;
+	Renderer.Init(*pEffect);
+
+	std::vector<uint8_t> Blob = Renderer.SavePreset();		// Default values
+	if(!TextPreset.empty() || !BlobPreset.empty()){
+		std::vector<uint8_t> Preset;
+		bool Ok = TextPreset.empty() ? DadHost::LoadBlob(BlobPreset, Preset)
+		                             : DadHost::LoadTextPreset(TextPreset, Preset);
+		if(!Ok){
+			fprintf(stderr, "penda_render: cannot read preset %s\n", TextPreset.empty() ? BlobPreset.c_str() : TextPreset.c_str());
+			return 1;
+		}
+		if(Preset.size() != Blob.size()){
+			fprintf(stderr, "penda_render: warning: preset holds %zu bytes, %s expects %zu\n",
+					Preset.size(), pEffect->Name, Blob.size());
+		}
+		memcpy(Blob.data(), Preset.data(), std::min(Blob.size(), Preset.size()));
+	}
+	for(auto &Set : SetValues){
+		if(!DadHost::setPresetValue(Blob, Set.first, Set.second)){
+			fprintf(stderr, "penda_render: preset value %zu out of range\n", Set.first);
+			return 1;
+		}
+	}
+	Renderer.RestorePreset(Blob);
+
+	if(!DumpPreset.empty()){
+		DadHost::SaveTextPreset(DumpPreset, Renderer.SavePreset(), pEffect->Name);
+	}
+	if(!DumpBlob.empty()){
+		DadHost::SaveBlob(DumpBlob, Renderer.SavePreset());
+	}
+
+	// Render -------------------------------------------------------------------
+	float SettleTime = WithSettle ? Renderer.Settle(30.0f) : 0.0f;
+
+	DadHost::cWavFile Out;
+	double WallTime = Renderer.Render(In, Out);
+	if(!Out.Save(OutPath, Format)){
+		fprintf(stderr, "penda_render: cannot write %s\n", OutPath.c_str());
+		return 1;
+	}
+
+	double AudioTime = In.getSize() / static_cast<double>(SAMPLING_RATE);
+	printf("%s: %s -> %s, %.2f s of audio (settled in %.2f s), block %u\n",
+		   pEffect->Name, InPath.c_str(), OutPath.c_str(), AudioTime, SettleTime, BlockSize);
+	printf("rendered in %.3f s: %.1f x realtime\n", WallTime, (WallTime > 0.0) ? AudioTime / WallTime : 0.0);
+	return 0;
+}
@@ -0,0 +1,302 @@
+//====================================================================================
+// PendaTest.cpp
+//
+// Host build: unit tests of the real-time hand-off logic and of the effect
+// chain bypass.
+//
+//   penda_test [case ...]
+//
+// cDeferredAudio runs with a simulated clock: the tests play the DMA capture /
+// transmit callbacks and the deferred DSP stage in a given order and check the
+// slot order and the drop, deadline miss and xrun counters.
+// The chain cases render the Tremolo -> Delay chain through cRenderer with the
+// slot bypass automated.
+// Exit code 1 if a check fails.
+//
+// Copyright(c) 2025 Dad Design.
+//====================================================================================
+#include "cDeferredAudio.h"
+#include "cRenderer.h"
+#include "HostPlatform.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using DadMisc::NO_AUDIO_SLOT;
+using DadMisc::eSlotState;
+
+//***********************************************************************************
+// Test helpers
+//***********************************************************************************
+
+// --------------------------------------------------------------------------
+// Simulated clock (ticks)
+static uint32_t __Ticks = 0;
+
+static uint32_t ReadClock() {
+	return __Ticks;
+}
+
+// --------------------------------------------------------------------------
+// Checks of the running case
+static int __Failures = 0;
+
+#define CHECK_EQUAL(Value, Expected)																	\
+	do{																									\
+		long long _Value = static_cast<long long>(Value);												\
+		long long _Expected = static_cast<long long>(Expected);										\
+		if(_Value != _Expected){																		\
+			printf("    %s:%d: %s is %lld, expected %lld\n", __FILE__, __LINE__, #Value, _Value, _Expected);	\
+			__Failures++;																				\
+		}																								\
+	}while(0)
+
+// --------------------------------------------------------------------------
+// cDeferredAudio with access to its sequence counter
+class cTestDeferredAudio : public DadMisc::cDeferredAudio {
+public:
+	inline void setCaptureSeq(uint32_t Seq) { m_CaptureSeq = Seq; }
+};
+
+constexpr uint32_t DEADLINE = 100;			// Ticks from capture to end of processing
+
+// --------------------------------------------------------------------------
+// Deferred stage run to completion on the waiting slots, Duration ticks each.
+// Returns the slots in processing order.
+static std::vector<int8_t> RunDSP(cTestDeferredAudio &Audio, uint32_t Duration) {
+	std::vector<int8_t> Order;
+	int8_t Slot;
+	while((Slot = Audio.BeginProcess()) != NO_AUDIO_SLOT){
+		CHECK_EQUAL(Audio.getSlotState(Slot), eSlotState::Processing);
+		__Ticks += Duration;
+		Audio.EndProcess(Slot);
+		Order.push_back(Slot);
+	}
+	return Order;
+}
+
+//***********************************************************************************
+// Cases
+//***********************************************************************************
+
+// --------------------------------------------------------------------------
+// Steady state: each half buffer is captured, processed before the next DMA
+// callback and transmitted one block later. No counter moves.
+static void TestSteadyState() {
+	cTestDeferredAudio Audio;
+	__Ticks = 0;
+	Audio.Init(ReadClock, DEADLINE);
+
+	CHECK_EQUAL(Audio.OutputSlot(), NO_AUDIO_SLOT);			// Start-up: no xrun
+	for(int Block = 0; Block < 8; Block++){
+		const uint8_t Slot = Block & 1;
+		CHECK_EQUAL(Audio.CaptureInput(Slot), true);
+		std::vector<int8_t> Order = RunDSP(Audio, 60);
+		CHECK_EQUAL(Order.size(), 1);
+		CHECK_EQUAL(Order[0], Slot);
+		__Ticks += DEADLINE - 60;
+		CHECK_EQUAL(Audio.OutputSlot(), Slot);
+	}
+	CHECK_EQUAL(Audio.getDroppedCount(), 0);
+	CHECK_EQUAL(Audio.getDeadlineMissCount(), 0);
+	CHECK_EQUAL(Audio.getXRunCount(), 0);
+	CHECK_EQUAL(Audio.getMaxLatencyTicks(), 60);
+}
+
+// --------------------------------------------------------------------------
+// Both slots captured before the DSP stage runs: the oldest goes first,
+// whichever slot it is
+static void TestOldestFirst() {
+	for(uint8_t First = 0; First < DadMisc::NB_AUDIO_SLOTS; First++){
+		cTestDeferredAudio Audio;
+		__Ticks = 0;
+		Audio.Init(ReadClock, DEADLINE);
+
+		CHECK_EQUAL(Audio.CaptureInput(First), true);
+		__Ticks += 10;
+		CHECK_EQUAL(Audio.CaptureInput(First ^ 1), true);
+		std::vector<int8_t> Order = RunDSP(Audio, 10);
+		CHECK_EQUAL(Order.size(), 2);
+		CHECK_EQUAL(Order[0], First);
+		CHECK_EQUAL(Order[1], First ^ 1);
+
+		// The transmit side gets the newest block
+		CHECK_EQUAL(Audio.OutputSlot(), First ^ 1);
+		CHECK_EQUAL(Audio.getDroppedCount(), 0);
+	}
+}
+
+// --------------------------------------------------------------------------
+// A slot captured again before it was processed, and a capture of the slot
+// the DSP stage is working on, both count as drops
+static void TestDrops() {
+	cTestDeferredAudio Audio;
+	__Ticks = 0;
+	Audio.Init(ReadClock, DEADLINE);
+
+	// Never processed: the new block replaces it
+	CHECK_EQUAL(Audio.CaptureInput(0), true);
+	CHECK_EQUAL(Audio.CaptureInput(0), true);
+	CHECK_EQUAL(Audio.getDroppedCount(), 1);
+	CHECK_EQUAL(Audio.getSlotState(0), eSlotState::Captured);
+
+	// Being processed: the new block is refused, the slot stays claimed
+	CHECK_EQUAL(Audio.BeginProcess(), 0);
+	CHECK_EQUAL(Audio.CaptureInput(0), false);
+	CHECK_EQUAL(Audio.getDroppedCount(), 2);
+	CHECK_EQUAL(Audio.getSlotState(0), eSlotState::Processing);
+	Audio.EndProcess(0);
+	CHECK_EQUAL(Audio.getSlotState(0), eSlotState::Ready);
+
+	// A ready slot can be captured again
+	CHECK_EQUAL(Audio.OutputSlot(), 0);
+	CHECK_EQUAL(Audio.CaptureInput(0), true);
+	CHECK_EQUAL(Audio.getDroppedCount(), 2);
+}
+
+// --------------------------------------------------------------------------
+// Deadline: a block finished exactly at the deadline is in time, one tick
+// later is a miss. The latency is measured across the clock wrap.
+static void TestDeadlineMiss() {
+	cTestDeferredAudio Audio;
+	__Ticks = 0xFFFFFFF0;
+	Audio.Init(ReadClock, DEADLINE);
+
+	CHECK_EQUAL(Audio.CaptureInput(0), true);
+	RunDSP(Audio, DEADLINE);
+	CHECK_EQUAL(Audio.getDeadlineMissCount(), 0);
+
+	CHECK_EQUAL(Audio.CaptureInput(1), true);
+	RunDSP(Audio, DEADLINE + 1);
+	CHECK_EQUAL(Audio.getDeadlineMissCount(), 1);
+	CHECK_EQUAL(Audio.getMaxLatencyTicks(), DEADLINE + 1);
+
+	Audio.reset();
+	CHECK_EQUAL(Audio.getDeadlineMissCount(), 0);
+	CHECK_EQUAL(Audio.getMaxLatencyTicks(), 0);
+}
+
+// --------------------------------------------------------------------------
+// Xruns: the transmit side finds no new block (already sent, or the DSP stage
+// is still on the slot) and sends silence
+static void TestXRuns() {
+	cTestDeferredAudio Audio;
+	__Ticks = 0;
+	Audio.Init(ReadClock, DEADLINE);
+
+	CHECK_EQUAL(Audio.CaptureInput(0), true);
+	RunDSP(Audio, 10);
+	CHECK_EQUAL(Audio.OutputSlot(), 0);
+	CHECK_EQUAL(Audio.OutputSlot(), NO_AUDIO_SLOT);			// Already sent
+	CHECK_EQUAL(Audio.getXRunCount(), 1);
+
+	// The ready slot is captured and claimed again before it is sent
+	CHECK_EQUAL(Audio.CaptureInput(1), true);
+	RunDSP(Audio, 10);
+	CHECK_EQUAL(Audio.CaptureInput(1), true);
+	CHECK_EQUAL(Audio.BeginProcess(), 1);
+	CHECK_EQUAL(Audio.OutputSlot(), NO_AUDIO_SLOT);
+	CHECK_EQUAL(Audio.getXRunCount(), 2);
+	Audio.EndProcess(1);
+	CHECK_EQUAL(Audio.OutputSlot(), 1);
+	CHECK_EQUAL(Audio.getXRunCount(), 2);
+}
+
+// --------------------------------------------------------------------------
+// Sequence numbers across the 2^32 wrap: the order stays oldest first and the
+// new numbers are never taken for the start-up state
+static void TestSequenceWrap() {
+	cTestDeferredAudio Audio;
+	__Ticks = 0;
+	Audio.Init(ReadClock, DEADLINE);
+	Audio.setCaptureSeq(0xFFFFFFFE);
+
+	CHECK_EQUAL(Audio.CaptureInput(1), true);				// 0xFFFFFFFF
+	CHECK_EQUAL(Audio.CaptureInput(0), true);				// 1 (0 is skipped)
+	std::vector<int8_t> Order = RunDSP(Audio, 10);
+	CHECK_EQUAL(Order.size(), 2);
+	CHECK_EQUAL(Order[0], 1);
+	CHECK_EQUAL(Order[1], 0);
+	CHECK_EQUAL(Audio.OutputSlot(), 0);
+
+	CHECK_EQUAL(Audio.CaptureInput(1), true);				// 2
+	RunDSP(Audio, 10);
+	CHECK_EQUAL(Audio.OutputSlot(), 1);
+	CHECK_EQUAL(Audio.getXRunCount(), 0);
+	CHECK_EQUAL(Audio.getDroppedCount(), 0);
+}
+
+//***********************************************************************************
+// Effect chain
+//***********************************************************************************
+
+constexpr uint32_t CHAIN_DELAY_ONOFF = 2;		// Preset index of the Delay slot On/Off
+
+// --------------------------------------------------------------------------
+// Peak of the chain output over [Start, End[ seconds
+static float PeakBetween(const DadHost::cWavFile &Wav, float Start, float End) {
+	const size_t First = static_cast<size_t>(Start * Wav.getSampleRate());
+	const size_t Last = std::min(static_cast<size_t>(End * Wav.getSampleRate()), Wav.getSize());
+	float Peak = 0.0f;
+	for(size_t Index = First; Index < Last; Index++){
+		Peak = std::max(Peak, std::max(std::fabs(Wav.m_Left[Index]), std::fabs(Wav.m_Right[Index])));
+	}
+	return Peak;
+}
+
+// --------------------------------------------------------------------------
+// Bypass of the Delay slot right after an impulse: the repeats already in the
+// delay lines still reach the output, and once they have died out the slot
+// switched on again replays nothing
+static void TestChainBypassTail() {
+	DadHost::cWavFile In, Out;
+	In.Create(20 * 48000, 48000);
+	In.m_Left[4800] = In.m_Right[4800] = 0.5f;				// Impulse at 0.1 s
+
+	DadHost::cRenderer Renderer;
+	Renderer.Init(*DadHost::FindEffect("tremolo-delay"));
+	Renderer.Settle(5.0f);
+	Renderer.Render(In, Out, {{0.2f, CHAIN_DELAY_ONOFF, 0.0f}, {18.0f, CHAIN_DELAY_ONOFF, 1.0f}});
+
+	CHECK_EQUAL(PeakBetween(Out, 0.3f, 2.0f) > 1e-3f, true);		// Repeats after the bypass
+	CHECK_EQUAL(PeakBetween(Out, 18.0f, 20.0f) < 1e-4f, true);		// Nothing stale on re-enable
+}
+
+// --------------------------------------------------------------------------
+struct sTestCase {
+	const char	*Name;
+	void		(*Run)();
+};
+
+static const sTestCase __TestCases[] = {
+	{"deferred-steady",		TestSteadyState},
+	{"deferred-order",		TestOldestFirst},
+	{"deferred-drops",		TestDrops},
+	{"deferred-deadline",	TestDeadlineMiss},
+	{"deferred-xruns",		TestXRuns},
+	{"deferred-seq-wrap",	TestSequenceWrap},
+	{"chain-bypass-tail",	TestChainBypassTail},
+};
+
+// --------------------------------------------------------------------------
+// Entry point
+int main(int argc, char *argv[]) {
+	DadHost::Init();
+	std::vector<std::string> Names(argv + 1, argv + argc);
+	int Failed = 0;
+	int Count = 0;
+	for(const sTestCase &Case : __TestCases){
+		if(!Names.empty() && (std::find(Names.begin(), Names.end(), Case.Name) == Names.end())){
+			continue;
+		}
+		__Failures = 0;
+		Case.Run();
+		printf("%-20s %s\n", Case.Name, (__Failures == 0) ? "pass" : "FAIL");
+		Failed += (__Failures == 0) ? 0 : 1;
+		Count++;
+	}
+	printf("%d case(s), %d failed\n", Count, Failed);
+	return (Failed == 0) ? 0 : 1;
+}